@@ -0,0 +1,181 @@
+#include <QuaternionAccumulator.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+// Drift and cost of composing long chains of one fixed small rotation, the worst case for
+// rounding because every step rounds the same way. The reference is the exact power of the
+// rounded step in long double, so the errors below are those of the composition alone.
+namespace
+{
+    constexpr std::size_t STEPS = 4096;
+    constexpr std::size_t NORMALIZE_EVERY = 1000;
+
+    using quaternionlib::Quaternion;
+    using quaternionlib::RotationAccumulator;
+
+    template <std::floating_point T>
+    auto SmallStep() -> Quaternion<T>
+    {
+        return Quaternion<T>{static_cast<T>(1e-3), static_cast<T>(-2e-3), static_cast<T>(2e-3), 1}
+            .Normalized();
+    }
+
+    template <std::floating_point T>
+    struct Chain
+    {
+        Quaternion<T> step;
+        long double x, y, z, angle;
+
+        explicit Chain(const Quaternion<T>& q)
+            : step(q)
+        {
+            const long double vector =
+                std::hypot(std::hypot(static_cast<long double>(q.X()), q.Y()), q.Z());
+
+            x = q.X() / vector;
+            y = q.Y() / vector;
+            z = q.Z() / vector;
+            angle = 2 * std::atan2(vector, static_cast<long double>(q.W()));
+        }
+
+        // Distance between the directions of q and of the exact power, about half the angle
+        // between them, and the deviation of |q| from 1.
+        auto Errors(const Quaternion<T>& q, std::size_t count, long double& direction,
+                    long double& norm) const -> void
+        {
+            const long double length =
+                std::sqrt(static_cast<long double>(q.X()) * q.X() +
+                          static_cast<long double>(q.Y()) * q.Y() +
+                          static_cast<long double>(q.Z()) * q.Z() +
+                          static_cast<long double>(q.W()) * q.W());
+            const long double half = angle * static_cast<long double>(count) / 2;
+            const long double s = std::sin(half);
+            const long double c = std::cos(half);
+
+            direction = std::hypot(std::hypot(q.X() / length - x * s, q.Y() / length - y * s),
+                                   std::hypot(q.Z() / length - z * s, q.W() / length - c));
+            norm = std::abs(length - 1);
+        }
+    };
+
+    auto Report(std::string_view method, std::size_t count, long double direction,
+                long double norm) -> void
+    {
+        std::cout << std::left << std::setw(30) << method << std::right << std::setw(10) << count
+                  << std::setprecision(3) << std::setw(12) << static_cast<double>(direction)
+                  << std::setw(12) << static_cast<double>(norm) << '\n';
+    }
+
+    template <std::floating_point T>
+    auto ReportDrift(std::string_view type) -> void
+    {
+        const Chain<T> chain{SmallStep<T>()};
+
+        std::cout << '\n'
+                  << "Drift of a fixed step, " << type << '\n'
+                  << std::left << std::setw(30) << "method" << std::right << std::setw(10)
+                  << "steps" << std::setw(12) << "direction" << std::setw(12) << "norm" << '\n';
+
+        for (std::size_t count = 1000; count <= 10'000'000; count *= 10)
+        {
+            Quaternion<T> plain{0, 0, 0, 1};
+            Quaternion<T> normalized{0, 0, 0, 1};
+            RotationAccumulator<T> accumulator;
+
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                plain *= chain.step;
+                normalized *= chain.step;
+                accumulator *= chain.step;
+
+                if (i % NORMALIZE_EVERY == 0)
+                {
+                    normalized.Normalize();
+                }
+            }
+
+            long double direction{}, norm{};
+
+            chain.Errors(plain, count, direction, norm);
+            Report("operator*=", count, direction, norm);
+            chain.Errors(normalized, count, direction, norm);
+            Report("operator*=, Normalize / 1000", count, direction, norm);
+            chain.Errors(accumulator.Value(), count, direction, norm);
+            Report("RotationAccumulator", count, direction, norm);
+        }
+    }
+
+    template <std::floating_point T>
+    auto BenchmarkThroughput() -> void
+    {
+        const auto step = SmallStep<T>();
+
+        BENCHMARK("operator*=")
+        {
+            Quaternion<T> q{0, 0, 0, 1};
+
+            for (std::size_t i = 0; i < STEPS; ++i)
+            {
+                q *= step;
+            }
+
+            return q;
+        };
+
+        BENCHMARK("operator*=, Normalize every step")
+        {
+            Quaternion<T> q{0, 0, 0, 1};
+
+            for (std::size_t i = 0; i < STEPS; ++i)
+            {
+                q *= step;
+                q.Normalize();
+            }
+
+            return q;
+        };
+
+        BENCHMARK("RotationAccumulator")
+        {
+            RotationAccumulator<T> accumulator;
+
+            for (std::size_t i = 0; i < STEPS; ++i)
+            {
+                accumulator *= step;
+            }
+
+            return accumulator.Value();
+        };
+
+        BENCHMARK("RotationAccumulator, Renormalize every step")
+        {
+            RotationAccumulator<T> accumulator;
+
+            for (std::size_t i = 0; i < STEPS; ++i)
+            {
+                accumulator *= step;
+                accumulator.Renormalize();
+            }
+
+            return accumulator.Value();
+        };
+    }
+} // namespace
+
+TEST_CASE("Compensated accumulation: double")
+{
+    ReportDrift<double>("double");
+    BenchmarkThroughput<double>();
+}
+
+TEST_CASE("Compensated accumulation: float")
+{
+    ReportDrift<float>("float");
+    BenchmarkThroughput<float>();
+}
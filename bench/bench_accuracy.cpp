@@ -0,0 +1,591 @@
+#include <AttitudeSimplifier.hpp>
+#include <QuaternionDistance.hpp>
+#include <QuaternionMath.hpp>
+#include <QuaternionProduct.hpp>
+#include "RandomRotations.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <string_view>
+#include <vector>
+
+// Differential harness: every kernel runs on random and adversarial inputs, is compared with the
+// same operation evaluated in long double and is then timed on the random inputs. Errors are
+// given in ulps of T relative to the largest reference component, so cancellation in a small
+// component is not blown out of proportion, and as the rotation angle to the reference. Results
+// that are not finite or vanish entirely are counted as failures instead.
+namespace
+{
+    constexpr std::size_t COUNT = 4096;
+    constexpr std::size_t SAMPLES_PER_SEGMENT = 16;
+
+    using quaternionlib::Keyframe;
+    using quaternionlib::MathPolicy;
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::test::RandomRotations;
+
+    using Reference = long double;
+
+    struct ErrorStats
+    {
+        Reference maxUlp = 0;
+        Reference sumUlp = 0;
+        Reference maxAngle = 0;
+        Reference sumAngle = 0;
+        std::size_t count = 0;
+        std::size_t failures = 0;
+
+        auto Add(Reference ulp, Reference angle) -> void
+        {
+            maxUlp = std::max(maxUlp, ulp);
+            sumUlp += ulp;
+            maxAngle = std::max(maxAngle, angle);
+            sumAngle += angle;
+            ++count;
+        }
+    };
+
+    template <std::floating_point T>
+    auto Ulp(Reference magnitude) -> Reference
+    {
+        const Reference spacing =
+            std::ldexp(static_cast<Reference>(std::numeric_limits<T>::epsilon()),
+                       std::ilogb(std::abs(magnitude)));
+
+        return std::max(spacing, static_cast<Reference>(std::numeric_limits<T>::denorm_min()));
+    }
+
+    template <std::floating_point T>
+    auto Widened(const Quaternion<T>& q) -> Quaternion<Reference>
+    {
+        return Quaternion<Reference>{q.X(), q.Y(), q.Z(), q.W()};
+    }
+
+    template <std::floating_point T>
+    auto Record(ErrorStats& stats, const Quaternion<T>& result,
+                const Quaternion<Reference>& reference) -> void
+    {
+        const auto wide = Widened(result);
+        const Reference components[4] = {wide.X(), wide.Y(), wide.Z(), wide.W()};
+        const Reference expected[4] = {reference.X(), reference.Y(), reference.Z(),
+                                       reference.W()};
+
+        Reference scale = 0;
+        Reference error = 0;
+
+        for (int k = 0; k < 4; ++k)
+        {
+            if (!std::isfinite(components[k]))
+            {
+                ++stats.failures;
+                return;
+            }
+
+            scale = std::max(scale, std::abs(expected[k]));
+            error = std::max(error, std::abs(components[k] - expected[k]));
+        }
+
+        if (wide.Norm() == 0)
+        {
+            ++stats.failures;
+            return;
+        }
+
+        stats.Add(error / Ulp<T>(scale),
+                  quaternionlib::AngularDistance(wide.Normalized(), reference.Normalized()));
+    }
+
+    // Scalar results are angles, so the absolute error is the angular error.
+    template <std::floating_point T>
+    auto Record(ErrorStats& stats, T result, Reference reference) -> void
+    {
+        if (!std::isfinite(result))
+        {
+            ++stats.failures;
+            return;
+        }
+
+        const Reference error = std::abs(result - reference);
+
+        stats.Add(error / Ulp<T>(reference), error);
+    }
+
+    auto Report(std::string_view kernel, std::string_view inputs, const ErrorStats& stats) -> void
+    {
+        const auto count = static_cast<Reference>(std::max<std::size_t>(stats.count, 1));
+
+        std::cout << std::left << std::setw(26) << kernel << std::setw(22) << inputs << std::right
+                  << std::setprecision(3) << std::setw(10) << static_cast<double>(stats.maxUlp)
+                  << std::setw(10) << static_cast<double>(stats.sumUlp / count) << std::setw(11)
+                  << static_cast<double>(stats.maxAngle) << std::setw(11)
+                  << static_cast<double>(stats.sumAngle / count) << std::setw(9) << stats.failures
+                  << '\n';
+    }
+
+    auto ReportHeader(std::string_view title) -> void
+    {
+        std::cout << '\n'
+                  << title << '\n'
+                  << std::left << std::setw(26) << "kernel" << std::setw(22) << "inputs"
+                  << std::right << std::setw(10) << "max ulp" << std::setw(10) << "mean ulp"
+                  << std::setw(11) << "max rad" << std::setw(11) << "mean rad" << std::setw(9)
+                  << "failed" << '\n';
+    }
+
+    // Multiplies q[i] by powers of ten spread evenly over [10^first, 10^last], rounding once.
+    template <std::floating_point T>
+    auto Scaled(std::vector<Quaternion<T>> q, int first, int last) -> std::vector<Quaternion<T>>
+    {
+        for (std::size_t i = 0; i < q.size(); ++i)
+        {
+            const Reference exponent = first + static_cast<Reference>(last - first) *
+                                                   static_cast<Reference>(i) /
+                                                   static_cast<Reference>(q.size() - 1);
+            const auto wide = Widened(q[i]) * std::pow(Reference{10}, exponent);
+
+            q[i] = Quaternion<T>{static_cast<T>(wide.X()), static_cast<T>(wide.Y()),
+                                 static_cast<T>(wide.Z()), static_cast<T>(wide.W())};
+        }
+
+        return q;
+    }
+
+    // Rotations by angle about random axes.
+    template <std::floating_point T>
+    auto Turns(std::size_t count, Reference angle, std::uint64_t seed) -> std::vector<Quaternion<T>>
+    {
+        auto turns = RandomRotations<T>(count, seed);
+
+        for (auto& q : turns)
+        {
+            const auto axis = Quaternion<Reference>{q.X(), q.Y(), q.Z(), 0}.Normalized();
+            const Reference s = std::sin(angle / 2);
+
+            q = Quaternion<T>{static_cast<T>(axis.X() * s), static_cast<T>(axis.Y() * s),
+                              static_cast<T>(axis.Z() * s), static_cast<T>(std::cos(angle / 2))};
+        }
+
+        return turns;
+    }
+
+    // Smallest perturbation that is still resolved in every component.
+    template <std::floating_point T>
+    const Reference SMALL_ANGLE = std::sqrt(std::numeric_limits<T>::epsilon());
+
+    // Inputs paired with the random rotations: nearly the same rotation, the same rotation
+    // with its sign flipped (antipodal quaternions) and rotations almost half a turn apart, where
+    // the dot product nearly vanishes and the shorter arc is decided by its rounding.
+    enum class Pairing
+    {
+        Random,
+        NearlyEqual,
+        NearlyAntipodal,
+        NearlyHalfTurn
+    };
+
+    template <std::floating_point T>
+    auto Partner(const Quaternion<T>& q, const Quaternion<T>& random, const Quaternion<T>& turn,
+                 Pairing pairing) -> Quaternion<T>
+    {
+        if (pairing == Pairing::Random)
+        {
+            return random;
+        }
+
+        const auto turned = q * turn;
+
+        return pairing == Pairing::NearlyAntipodal ? -turned : turned;
+    }
+
+    template <std::floating_point T>
+    auto PairingTurns(Pairing pairing, std::uint64_t seed) -> std::vector<Quaternion<T>>
+    {
+        const Reference angle = pairing == Pairing::NearlyHalfTurn
+                                    ? std::numbers::pi_v<Reference> - SMALL_ANGLE<T>
+                                    : SMALL_ANGLE<T>;
+
+        return Turns<T>(COUNT, angle, seed);
+    }
+
+    auto PairingName(Pairing pairing) -> std::string_view
+    {
+        switch (pairing)
+        {
+        case Pairing::Random:
+            return "random";
+        case Pairing::NearlyEqual:
+            return "nearly equal";
+        case Pairing::NearlyAntipodal:
+            return "nearly antipodal";
+        case Pairing::NearlyHalfTurn:
+            return "nearly half a turn";
+        }
+
+        return "";
+    }
+
+    constexpr Pairing PAIRINGS[] = {Pairing::Random, Pairing::NearlyEqual,
+                                    Pairing::NearlyAntipodal, Pairing::NearlyHalfTurn};
+
+    auto ReferenceSlerp(const Quaternion<Reference>& lhs, Quaternion<Reference> rhs,
+                        Reference t) -> Quaternion<Reference>
+    {
+        if (quaternionlib::Dot(lhs, rhs) < 0)
+        {
+            rhs = -rhs;
+        }
+
+        const Reference angle = 2 * std::atan2((lhs - rhs).Norm(), (lhs + rhs).Norm());
+
+        if (angle == 0)
+        {
+            return lhs;
+        }
+
+        const Reference sine = std::sin(angle);
+
+        return lhs * (std::sin((1 - t) * angle) / sine) + rhs * (std::sin(t * angle) / sine);
+    }
+
+    template <std::floating_point T>
+    auto Normalization() -> void
+    {
+        const auto rotations = RandomRotations<T>(COUNT, 1);
+        constexpr int tiny = std::numeric_limits<T>::min_exponent10;
+        constexpr int huge = std::numeric_limits<T>::max_exponent10;
+
+        struct InputSet
+        {
+            std::string_view name;
+            std::vector<Quaternion<T>> q;
+        };
+
+        const InputSet sets[] = {{"unnormalized", Scaled(rotations, -3, 3)},
+                                 {"near-zero norm", Scaled(rotations, tiny / 2, tiny - 4)},
+                                 {"huge magnitude", Scaled(rotations, huge / 2, huge - 1)}};
+
+        ReportHeader("Normalization");
+
+        for (const auto& set : sets)
+        {
+            ErrorStats member, deterministic, fast, batch;
+            QuaternionSoA<T> soa{set.q};
+
+            quaternionlib::Normalize<MathPolicy::Fast, T>(soa.View());
+
+            for (std::size_t i = 0; i < set.q.size(); ++i)
+            {
+                const auto expected = Widened(set.q[i]).Normalized();
+
+                Record(member, set.q[i].Normalized(), expected);
+                Record(deterministic,
+                       quaternionlib::Normalized<MathPolicy::Deterministic>(set.q[i]), expected);
+                Record(fast, quaternionlib::Normalized<MathPolicy::Fast>(set.q[i]), expected);
+                Record(batch, soa.View().Load(i), expected);
+            }
+
+            Report("Normalized()", set.name, member);
+            Report("Normalized, deterministic", set.name, deterministic);
+            Report("Normalized, fast", set.name, fast);
+            Report("Normalize SoA, fast", set.name, batch);
+        }
+
+        const auto& input = sets[0].q;
+        std::vector<Quaternion<T>> out(COUNT);
+        QuaternionSoA<T> soa{input};
+
+        BENCHMARK("Normalized()")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = input[i].Normalized();
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("Normalized, deterministic")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = quaternionlib::Normalized<MathPolicy::Deterministic>(input[i]);
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("Normalized, fast")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = quaternionlib::Normalized<MathPolicy::Fast>(input[i]);
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("Normalize SoA, fast")
+        {
+            quaternionlib::Normalize<MathPolicy::Fast, T>(soa.View());
+            return soa.View().Load(0);
+        };
+    }
+
+    template <std::floating_point T>
+    auto Products() -> void
+    {
+        constexpr int huge = std::numeric_limits<T>::max_exponent10;
+
+        const auto lhs = RandomRotations<T>(COUNT, 2);
+        const auto random = RandomRotations<T>(COUNT, 3);
+        const auto turns = Turns<T>(COUNT, SMALL_ANGLE<T>, 4);
+
+        // q^-1 (q p) for a small turn p cancels down to nearly the identity.
+        std::vector<Quaternion<T>> inverses(COUNT);
+        std::vector<Quaternion<T>> cancelling(COUNT);
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            inverses[i] = lhs[i].Conjugated();
+            cancelling[i] = lhs[i] * turns[i];
+        }
+
+        struct InputSet
+        {
+            std::string_view name;
+            std::vector<Quaternion<T>> lhs;
+            std::vector<Quaternion<T>> rhs;
+        };
+
+        const InputSet sets[] = {{"random", lhs, random},
+                                 {"cancelling", inverses, cancelling},
+                                 {"huge magnitude", Scaled(lhs, huge / 2 - 2, huge / 2 + 2),
+                                  Scaled(random, huge / 2 - 2, huge / 2 + 2)}};
+
+        ReportHeader("Products");
+
+        for (const auto& set : sets)
+        {
+            ErrorStats member, deterministic, fast, matrix;
+            std::vector<Quaternion<T>> broadcast(COUNT);
+
+            quaternionlib::LeftMultiplyAll<T>(set.lhs.front(), set.rhs, broadcast);
+
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                const auto expected = Widened(set.lhs[i]) * Widened(set.rhs[i]);
+
+                Record(member, set.lhs[i] * set.rhs[i], expected);
+                Record(deterministic,
+                       quaternionlib::Multiply<MathPolicy::Deterministic>(set.lhs[i], set.rhs[i]),
+                       expected);
+                Record(fast, quaternionlib::Multiply<MathPolicy::Fast>(set.lhs[i], set.rhs[i]),
+                       expected);
+                Record(matrix, broadcast[i], Widened(set.lhs.front()) * Widened(set.rhs[i]));
+            }
+
+            Report("operator*", set.name, member);
+            Report("Multiply, deterministic", set.name, deterministic);
+            Report("Multiply, fast", set.name, fast);
+            Report("LeftMultiplyAll", set.name, matrix);
+        }
+
+        std::vector<Quaternion<T>> out(COUNT);
+
+        BENCHMARK("operator*")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = lhs[i] * random[i];
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("Multiply, deterministic")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = quaternionlib::Multiply<MathPolicy::Deterministic>(lhs[i], random[i]);
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("Multiply, fast")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = quaternionlib::Multiply<MathPolicy::Fast>(lhs[i], random[i]);
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("LeftMultiplyAll")
+        {
+            quaternionlib::LeftMultiplyAll<T>(lhs.front(), random, out);
+            return out.front();
+        };
+    }
+
+    // Slerp between consecutive keyframes, each paired with the one before it.
+    template <std::floating_point T>
+    auto Interpolation() -> void
+    {
+        constexpr std::size_t segments = COUNT / SAMPLES_PER_SEGMENT;
+
+        const auto random = RandomRotations<T>(segments + 1, 5);
+
+        std::vector<double> times;
+
+        for (std::size_t i = 0; i < segments * SAMPLES_PER_SEGMENT; ++i)
+        {
+            times.push_back((static_cast<double>(i) + 0.5) / SAMPLES_PER_SEGMENT);
+        }
+
+        const auto keyframesFor = [&](Pairing pairing)
+        {
+            const auto turns = PairingTurns<T>(pairing, 6);
+            std::vector<Keyframe<T>> keyframes{{0.0, random.front()}};
+
+            for (std::size_t k = 1; k <= segments; ++k)
+            {
+                keyframes.push_back({static_cast<double>(k),
+                                     Partner(keyframes.back().orientation, random[k], turns[k],
+                                             pairing)});
+            }
+
+            return keyframes;
+        };
+
+        ReportHeader("Interpolation");
+
+        for (const auto pairing : PAIRINGS)
+        {
+            const auto keyframes = keyframesFor(pairing);
+            ErrorStats scalar, batch;
+            std::vector<Quaternion<T>> reconstructed(times.size());
+
+            quaternionlib::Reconstruct<T>(keyframes, times, reconstructed);
+
+            for (std::size_t i = 0; i < times.size(); ++i)
+            {
+                const auto k = i / SAMPLES_PER_SEGMENT;
+                const auto& from = keyframes[k].orientation;
+                const auto& to = keyframes[k + 1].orientation;
+                const double t = times[i] - static_cast<double>(k);
+                const auto expected = ReferenceSlerp(Widened(from), Widened(to), t);
+
+                Record(scalar, quaternionlib::Slerp(from, to, static_cast<T>(t)), expected);
+                Record(batch, reconstructed[i], expected);
+            }
+
+            Report("Slerp", PairingName(pairing), scalar);
+            Report("Reconstruct", PairingName(pairing), batch);
+        }
+
+        const auto keyframes = keyframesFor(Pairing::Random);
+        std::vector<Quaternion<T>> out(times.size());
+
+        BENCHMARK("Slerp")
+        {
+            for (std::size_t i = 0; i < times.size(); ++i)
+            {
+                const auto k = i / SAMPLES_PER_SEGMENT;
+                const auto t = static_cast<T>(times[i] - static_cast<double>(k));
+
+                out[i] = quaternionlib::Slerp(keyframes[k].orientation,
+                                              keyframes[k + 1].orientation, t);
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("Reconstruct")
+        {
+            quaternionlib::Reconstruct<T>(keyframes, times, out);
+            return out.front();
+        };
+    }
+
+    template <std::floating_point T>
+    auto Distances() -> void
+    {
+        const auto query = RandomRotations<T>(1, 7).front();
+        const auto random = RandomRotations<T>(COUNT, 8);
+
+        ReportHeader("Angular distance");
+
+        for (const auto pairing : PAIRINGS)
+        {
+            const auto turns = PairingTurns<T>(pairing, 9);
+            std::vector<Quaternion<T>> points(COUNT);
+            std::vector<T> batch(COUNT);
+            ErrorStats scalarStats, batchStats;
+
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                points[i] = Partner(query, random[i], turns[i], pairing);
+            }
+
+            quaternionlib::Distances<T>(query, points, batch);
+
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                const auto expected = quaternionlib::AngularDistance(Widened(query),
+                                                                     Widened(points[i]));
+
+                Record(scalarStats, quaternionlib::AngularDistance(query, points[i]), expected);
+                Record(batchStats, batch[i], expected);
+            }
+
+            Report("AngularDistance", PairingName(pairing), scalarStats);
+            Report("Distances", PairingName(pairing), batchStats);
+        }
+
+        std::vector<T> out(COUNT);
+
+        BENCHMARK("AngularDistance")
+        {
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = quaternionlib::AngularDistance(query, random[i]);
+            }
+
+            return out.front();
+        };
+
+        BENCHMARK("Distances")
+        {
+            quaternionlib::Distances<T>(query, random, out);
+            return out.front();
+        };
+    }
+} // namespace
+
+TEST_CASE("Kernel accuracy and throughput: double")
+{
+    std::cout << "\ndouble, errors against long double";
+    Normalization<double>();
+    Products<double>();
+    Interpolation<double>();
+    Distances<double>();
+}
+
+TEST_CASE("Kernel accuracy and throughput: float")
+{
+    std::cout << "\nfloat, errors against long double";
+    Normalization<float>();
+    Products<float>();
+    Interpolation<float>();
+    Distances<float>();
+}
@@ -0,0 +1,75 @@
+#include <QuaternionDistance.hpp>
+#include <QuaternionRandom.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t POINTS = 100000;
+    constexpr std::size_t MATRIX = 1000;
+} // namespace
+
+TEST_CASE("Rotation distance throughput")
+{
+    std::vector<quaternionlib::Quaternion<double>> points(POINTS);
+    quaternionlib::RandomRotationGenerator<double>{1}.Generate(points);
+
+    const quaternionlib::QuaternionSoA<double> soa{points};
+    const auto query = points.back();
+    const auto set = std::span<const quaternionlib::Quaternion<double>>{points}.first(MATRIX);
+
+    std::vector<double> out(POINTS);
+    std::vector<double> matrix(MATRIX * MATRIX);
+
+    BENCHMARK("Scalar 2 * acos(|dot|) per point")
+    {
+        for (std::size_t i = 0; i < POINTS; ++i)
+        {
+            const double dot = query.X() * points[i].X() + query.Y() * points[i].Y() +
+                               query.Z() * points[i].Z() + query.W() * points[i].W();
+
+            out[i] = 2 * std::acos(std::min(std::abs(dot), 1.0));
+        }
+
+        return out.front();
+    };
+
+    BENCHMARK("Batched angle, AoS")
+    {
+        quaternionlib::Distances<double>(query, points, out);
+        return out.front();
+    };
+
+    BENCHMARK("Batched angle, SoA")
+    {
+        quaternionlib::Distances(query, soa.View(), std::span{out});
+        return out.front();
+    };
+
+    BENCHMARK("Batched inner product, SoA")
+    {
+        quaternionlib::Distances(query, soa.View(), std::span{out},
+                                 quaternionlib::DistanceMetric::InnerProduct);
+        return out.front();
+    };
+
+    BENCHMARK("Nearest of 100k")
+    {
+        return quaternionlib::Nearest(query, soa.View());
+    };
+
+    BENCHMARK("1000 x 1000 angle matrix")
+    {
+        quaternionlib::DistanceMatrix<double>(set, set, matrix);
+        return matrix.front();
+    };
+
+    BENCHMARK("1000 x 1000 angle matrix, all threads")
+    {
+        quaternionlib::DistanceMatrix<double>(set, set, matrix,
+                                              quaternionlib::DistanceMetric::Angle, 0);
+        return matrix.front();
+    };
+}
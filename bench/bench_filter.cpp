@@ -0,0 +1,121 @@
+#include <AttitudeFilter.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t DEVICES = 10000;
+    constexpr double DT = 0.005;
+
+    struct Samples
+    {
+        explicit Samples(std::size_t n)
+            : gx(n), gy(n), gz(n), ax(n), ay(n), az(n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const auto t = static_cast<double>(i);
+
+                gx[i] = 0.1 * std::sin(t);
+                gy[i] = 0.2 * std::cos(t);
+                gz[i] = 0.05;
+                ax[i] = std::sin(0.3 * t);
+                ay[i] = std::cos(0.3 * t);
+                az[i] = 9.81;
+            }
+        }
+
+        std::vector<double> gx, gy, gz, ax, ay, az;
+    };
+
+    // Per-device Madgwick update on top of Quaternion<double>, as the existing services do.
+    auto ScalarMadgwick(quaternionlib::Quaternion<double>& q, double gx, double gy, double gz,
+                        double ax, double ay, double az, double beta, double dt) -> void
+    {
+        auto qDot = q * quaternionlib::Quaternion<double>{gx, gy, gz, 0.0} * 0.5;
+
+        const double accelNorm = std::sqrt(ax * ax + ay * ay + az * az);
+
+        if (accelNorm > 0.0)
+        {
+            ax /= accelNorm;
+            ay /= accelNorm;
+            az /= accelNorm;
+
+            const double q0 = q.W(), q1 = q.X(), q2 = q.Y(), q3 = q.Z();
+            const double s0 = 4 * q0 * q2 * q2 + 2 * q2 * ax + 4 * q0 * q1 * q1 - 2 * q1 * ay;
+            const double s1 = 4 * q1 * q3 * q3 - 2 * q3 * ax + 4 * q0 * q0 * q1 - 2 * q0 * ay -
+                              4 * q1 + 8 * q1 * q1 * q1 + 8 * q1 * q2 * q2 + 4 * q1 * az;
+            const double s2 = 4 * q0 * q0 * q2 + 2 * q0 * ax + 4 * q2 * q3 * q3 - 2 * q3 * ay -
+                              4 * q2 + 8 * q2 * q1 * q1 + 8 * q2 * q2 * q2 + 4 * q2 * az;
+            const double s3 = 4 * q1 * q1 * q3 - 2 * q1 * ax + 4 * q2 * q2 * q3 - 2 * q2 * ay;
+
+            qDot -= quaternionlib::Quaternion<double>{s1, s2, s3, s0}.Normalized() * beta;
+        }
+
+        q += qDot * dt;
+        q.Normalize();
+    }
+} // namespace
+
+TEST_CASE("IMU filter bank throughput")
+{
+    const Samples samples{DEVICES};
+    const quaternionlib::Vector3SoASpan<const double> gyro{samples.gx, samples.gy, samples.gz};
+    const quaternionlib::Vector3SoASpan<const double> accel{samples.ax, samples.ay, samples.az};
+
+    std::vector<quaternionlib::Quaternion<double>> scalar(DEVICES, {0.0, 0.0, 0.0, 1.0});
+    quaternionlib::MadgwickFilterBank<double> madgwick{DEVICES};
+    quaternionlib::MahonyFilterBank<double> mahony{DEVICES, 1.0, 0.1};
+    quaternionlib::MadgwickFilterBank<float> madgwickFloat{DEVICES};
+
+    std::vector<float> floats[6];
+
+    for (std::size_t i = 0; i < DEVICES; ++i)
+    {
+        floats[0].push_back(static_cast<float>(samples.gx[i]));
+        floats[1].push_back(static_cast<float>(samples.gy[i]));
+        floats[2].push_back(static_cast<float>(samples.gz[i]));
+        floats[3].push_back(static_cast<float>(samples.ax[i]));
+        floats[4].push_back(static_cast<float>(samples.ay[i]));
+        floats[5].push_back(static_cast<float>(samples.az[i]));
+    }
+
+    BENCHMARK("Scalar Madgwick per device (double)")
+    {
+        for (std::size_t i = 0; i < DEVICES; ++i)
+        {
+            ScalarMadgwick(scalar[i], samples.gx[i], samples.gy[i], samples.gz[i], samples.ax[i],
+                           samples.ay[i], samples.az[i], 0.1, DT);
+        }
+
+        return scalar.front();
+    };
+
+    BENCHMARK("Madgwick bank (double)")
+    {
+        madgwick.Update(gyro, accel, DT);
+        return madgwick.Orientation(0);
+    };
+
+    BENCHMARK("Madgwick bank (float)")
+    {
+        madgwickFloat.Update({floats[0], floats[1], floats[2]}, {floats[3], floats[4], floats[5]},
+                             static_cast<float>(DT));
+        return madgwickFloat.Orientation(0);
+    };
+
+    BENCHMARK("Mahony bank (double)")
+    {
+        mahony.Update(gyro, accel, DT);
+        return mahony.Orientation(0);
+    };
+
+    BENCHMARK("Madgwick bank (double), all threads")
+    {
+        madgwick.Update(gyro, accel, DT, 0);
+        return madgwick.Orientation(0);
+    };
+}
@@ -0,0 +1,127 @@
+#include <AttitudeIntegrator.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t BODIES = 200000;
+    constexpr double DT = 1.0 / 240.0;
+
+    struct Bodies
+    {
+        explicit Bodies(std::size_t n)
+            : q(n), wx(n), wy(n), wz(n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const auto t = static_cast<double>(i);
+
+                q.View().Store(i, quaternionlib::Quaternion<double>{std::sin(t), std::cos(t),
+                                                                    0.5, 1.0}
+                                      .Normalized());
+                wx[i] = std::sin(0.3 * t) * 4.0;
+                wy[i] = std::cos(0.7 * t) * 4.0;
+                wz[i] = std::sin(1.1 * t) * 4.0;
+            }
+        }
+
+        [[nodiscard]] auto Omega() const -> quaternionlib::Vector3SoASpan<const double>
+        {
+            return {wx, wy, wz};
+        }
+
+        quaternionlib::QuaternionSoA<double> q;
+        std::vector<double> wx, wy, wz;
+    };
+
+    // The per-body code this module replaces: build the increment, multiply, renormalize.
+    auto NaiveStep(quaternionlib::Quaternion<double>& q, double wx, double wy, double wz,
+                   double dt) -> void
+    {
+        const double norm = std::sqrt(wx * wx + wy * wy + wz * wz);
+        const double angle = norm * dt / 2;
+        const double s = norm > 0.0 ? std::sin(angle) / norm : dt / 2;
+
+        q *= quaternionlib::Quaternion<double>{wx * s, wy * s, wz * s, std::cos(angle)};
+        q.Normalize();
+    }
+} // namespace
+
+TEST_CASE("Attitude integrator throughput")
+{
+    Bodies bodies{BODIES};
+    auto aos = bodies.q.ToAoS();
+
+    BENCHMARK("Naive AoS product + Normalize")
+    {
+        for (std::size_t i = 0; i < aos.size(); ++i)
+        {
+            NaiveStep(aos[i], bodies.wx[i], bodies.wy[i], bodies.wz[i], DT);
+        }
+
+        return aos.front();
+    };
+
+    BENCHMARK("Exponential map, SoA, 1 thread")
+    {
+        quaternionlib::IntegrateExponential(bodies.q.View(), bodies.Omega(), DT);
+        return bodies.q.View().Load(0);
+    };
+
+    BENCHMARK("Exponential map, SoA, all threads")
+    {
+        quaternionlib::IntegrateExponential(bodies.q.View(), bodies.Omega(), DT, 0);
+        return bodies.q.View().Load(0);
+    };
+
+    BENCHMARK("RK4, SoA, 1 thread")
+    {
+        quaternionlib::IntegrateRK4(bodies.q.View(), bodies.Omega(), DT);
+        return bodies.q.View().Load(0);
+    };
+
+    BENCHMARK("RK4, SoA, all threads")
+    {
+        quaternionlib::IntegrateRK4(bodies.q.View(), bodies.Omega(), DT, 0);
+        return bodies.q.View().Load(0);
+    };
+}
+
+TEST_CASE("Attitude integrator drift")
+{
+    constexpr int steps = 1000000;
+    constexpr double wx = 0.3, wy = -1.2, wz = 2.5;
+
+    const double norm = std::sqrt(wx * wx + wy * wy + wz * wz);
+    const double angle = norm * DT * steps / 2;
+    const quaternionlib::Quaternion<double> exact{wx / norm * std::sin(angle),
+                                                  wy / norm * std::sin(angle),
+                                                  wz / norm * std::sin(angle), std::cos(angle)};
+
+    quaternionlib::Quaternion<double> naive{0.0, 0.0, 0.0, 1.0};
+    quaternionlib::Quaternion<double> exponential{naive};
+    quaternionlib::Quaternion<double> rk4{naive};
+
+    for (int i = 0; i < steps; ++i)
+    {
+        NaiveStep(naive, wx, wy, wz, DT);
+        quaternionlib::IntegrateExponential(exponential, wx, wy, wz, DT);
+        quaternionlib::IntegrateRK4(rk4, wx, wy, wz, wx, wy, wz, DT);
+    }
+
+    const auto report = [&](const char* name, const quaternionlib::Quaternion<double>& q)
+    {
+        std::cout << name << ": |norm - 1| = " << std::abs(q.Norm() - 1.0)
+                  << ", distance to exact = " << (q - exact).Norm() << '\n';
+    };
+
+    std::cout << "After " << steps << " steps of " << DT << " s:\n";
+    report("Naive + Normalize", naive);
+    report("Exponential map", exponential);
+    report("RK4", rk4);
+
+    CHECK(std::abs(exponential.Norm() - 1.0) < 1e-9);
+}
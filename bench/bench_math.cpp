@@ -0,0 +1,107 @@
+#include <QuaternionMath.hpp>
+#include <QuaternionRandom.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t COUNT = 4096;
+
+    using quaternionlib::MathPolicy;
+    using quaternionlib::Quaternion;
+} // namespace
+
+TEST_CASE("Math policy throughput")
+{
+    std::vector<Quaternion<double>> lhs(COUNT);
+    std::vector<Quaternion<double>> rhs(COUNT);
+    quaternionlib::RandomRotationGenerator<double>{1}.Generate(lhs);
+    quaternionlib::RandomRotationGenerator<double>{2}.Generate(rhs);
+
+    const quaternionlib::QuaternionSoA<double> left{lhs};
+    const quaternionlib::QuaternionSoA<double> right{rhs};
+    quaternionlib::QuaternionSoA<double> out(COUNT);
+    std::vector<Quaternion<double>> products(COUNT);
+
+    BENCHMARK("operator* chain, compiler flags")
+    {
+        auto q = lhs.front();
+
+        for (const auto& r : rhs)
+        {
+            q = q * r;
+        }
+
+        return q;
+    };
+
+    BENCHMARK("Multiply chain, deterministic")
+    {
+        auto q = lhs.front();
+
+        for (const auto& r : rhs)
+        {
+            q = quaternionlib::Multiply<MathPolicy::Deterministic>(q, r);
+        }
+
+        return q;
+    };
+
+    BENCHMARK("Multiply chain, fast")
+    {
+        auto q = lhs.front();
+
+        for (const auto& r : rhs)
+        {
+            q = quaternionlib::Multiply<MathPolicy::Fast>(q, r);
+        }
+
+        return q;
+    };
+
+    BENCHMARK("operator* AoS, compiler flags")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            products[i] = lhs[i] * rhs[i];
+        }
+
+        return products.front();
+    };
+
+    BENCHMARK("Multiply SoA, deterministic")
+    {
+        quaternionlib::Multiply<MathPolicy::Deterministic, double>(left.View(), right.View(),
+                                                                   out.View());
+        return out.View().Load(0);
+    };
+
+    BENCHMARK("Multiply SoA, fast")
+    {
+        quaternionlib::Multiply<MathPolicy::Fast, double>(left.View(), right.View(), out.View());
+        return out.View().Load(0);
+    };
+
+    BENCHMARK("Normalized AoS, compiler flags")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            products[i] = lhs[i].Normalized();
+        }
+
+        return products.front();
+    };
+
+    BENCHMARK("Normalize SoA, deterministic")
+    {
+        quaternionlib::Normalize<MathPolicy::Deterministic, double>(out.View());
+        return out.View().Load(0);
+    };
+
+    BENCHMARK("Normalize SoA, fast")
+    {
+        quaternionlib::Normalize<MathPolicy::Fast, double>(out.View());
+        return out.View().Load(0);
+    };
+}
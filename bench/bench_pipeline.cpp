@@ -0,0 +1,107 @@
+#include <QuaternionFormat.hpp>
+#include <QuaternionParse.hpp>
+#include <QuaternionPipeline.hpp>
+#include <QuaternionRandom.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t COUNT = 100000;
+    constexpr std::size_t FACTOR = 4;
+
+    using quaternionlib::Quaternion;
+
+    namespace pipeline = quaternionlib::pipeline;
+} // namespace
+
+TEST_CASE("Pipeline throughput")
+{
+    std::vector<Quaternion<double>> rotations(COUNT);
+    quaternionlib::RandomRotationGenerator<double>{1}.Generate(rotations);
+
+    std::ostringstream csv;
+    pipeline::Write(pipeline::Chunks<double>(rotations), csv);
+    const auto text = csv.str();
+
+    // Parse, normalize, downsample and write back to text.
+    BENCHMARK("Buffered loops")
+    {
+        std::istringstream in{text};
+        const std::string all{std::istreambuf_iterator<char>{in}, {}};
+        auto parsed = quaternionlib::ParseText<double>(all);
+
+        for (auto& q : parsed)
+        {
+            q = quaternionlib::Normalized<quaternionlib::MathPolicy::Fast>(q);
+        }
+
+        std::vector<Quaternion<double>> kept;
+
+        for (std::size_t i = 0; i < parsed.size(); i += FACTOR)
+        {
+            kept.push_back(parsed[i]);
+        }
+
+        std::vector<char> buffer(quaternionlib::MaxTextSize<double>(kept.size()));
+        const auto result = quaternionlib::WriteCsv<double>(kept, buffer);
+        std::ostringstream out;
+        out.write(buffer.data(), result.ptr - buffer.data());
+
+        return out.tellp();
+    };
+
+    BENCHMARK("Pipeline")
+    {
+        std::istringstream in{text};
+        std::ostringstream out;
+
+        auto parsed = pipeline::Parse<double>(pipeline::ReadText(in));
+
+        return pipeline::Write(pipeline::Downsample(pipeline::Normalize(std::move(parsed)), FACTOR),
+                               out);
+    };
+
+    BENCHMARK("Pipeline, parsing on a worker thread")
+    {
+        std::istringstream in{text};
+        std::ostringstream out;
+
+        auto parsed = pipeline::Threaded(pipeline::Parse<double>(pipeline::ReadText(in)));
+
+        return pipeline::Write(pipeline::Downsample(pipeline::Normalize(std::move(parsed)), FACTOR),
+                               out);
+    };
+
+    // Chunk size alone, without parsing.
+    BENCHMARK("In-memory stages, chunks of 1")
+    {
+        std::size_t count = 0;
+
+        for (const auto chunk : pipeline::Downsample(
+                 pipeline::Normalize(pipeline::Chunks<double>(rotations, 1)), FACTOR))
+        {
+            count += chunk.size();
+        }
+
+        return count;
+    };
+
+    BENCHMARK("In-memory stages, chunks of 1024")
+    {
+        std::size_t count = 0;
+
+        for (const auto chunk :
+             pipeline::Downsample(pipeline::Normalize(pipeline::Chunks<double>(rotations)), FACTOR))
+        {
+            count += chunk.size();
+        }
+
+        return count;
+    };
+}
@@ -0,0 +1,51 @@
+#include <QuaternionProduct.hpp>
+#include <QuaternionRandom.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t COUNT = 4096;
+
+    using quaternionlib::Quaternion;
+} // namespace
+
+TEST_CASE("One-to-many product throughput")
+{
+    std::vector<Quaternion<double>> points(COUNT);
+    quaternionlib::RandomRotationGenerator<double>{1}.Generate(points);
+
+    const auto frame = Quaternion<double>{0.3, -1.2, 0.7, 2.0}.Normalized();
+    const quaternionlib::QuaternionSoA<double> in{points};
+    quaternionlib::QuaternionSoA<double> out(COUNT);
+    std::vector<Quaternion<double>> products(COUNT);
+
+    BENCHMARK("operator* AoS")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            products[i] = frame * points[i];
+        }
+
+        return products.front();
+    };
+
+    BENCHMARK("LeftMultiplyAll AoS")
+    {
+        quaternionlib::LeftMultiplyAll<double>(frame, points, products);
+        return products.front();
+    };
+
+    BENCHMARK("LeftMultiplyAll SoA")
+    {
+        quaternionlib::LeftMultiplyAll<double>(frame, in.View(), out.View());
+        return out.View().Load(0);
+    };
+
+    BENCHMARK("RightMultiplyAll SoA, in place")
+    {
+        quaternionlib::RightMultiplyAll<double>(out.View(), frame);
+        return out.View().Load(0);
+    };
+}
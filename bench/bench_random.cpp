@@ -0,0 +1,80 @@
+#include <QuaternionRandom.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t SAMPLES = 100000;
+
+    // Shoemake's method on top of <random> and libm, one sample at a time.
+    template <typename T>
+    auto StdUniformRotation(std::mt19937_64& engine) -> quaternionlib::Quaternion<T>
+    {
+        std::uniform_real_distribution<T> uniform{0, 1};
+
+        const T u1 = uniform(engine);
+        const T u2 = 2 * std::numbers::pi_v<T> * uniform(engine);
+        const T u3 = 2 * std::numbers::pi_v<T> * uniform(engine);
+        const T a = std::sqrt(1 - u1);
+        const T b = std::sqrt(u1);
+
+        return quaternionlib::Quaternion<T>{a * std::sin(u2), a * std::cos(u2), b * std::sin(u3),
+                                            b * std::cos(u3)};
+    }
+} // namespace
+
+TEST_CASE("Random rotation throughput")
+{
+    std::mt19937_64 engine{42};
+    const quaternionlib::RandomRotationGenerator<double> generator{42};
+    const quaternionlib::RandomRotationGenerator<float> generatorFloat{42};
+
+    std::vector<quaternionlib::Quaternion<double>> out(SAMPLES);
+    std::vector<quaternionlib::Quaternion<float>> outFloat(SAMPLES);
+    quaternionlib::QuaternionSoA<float> soa(SAMPLES);
+    const quaternionlib::Quaternion<double> mean{0.0, 0.0, 0.0, 1.0};
+
+    BENCHMARK("mt19937_64 + libm Shoemake (double)")
+    {
+        for (auto& q : out)
+        {
+            q = StdUniformRotation<double>(engine);
+        }
+
+        return out.front();
+    };
+
+    BENCHMARK("Generator, AoS (double)")
+    {
+        generator.Generate(out);
+        return out.front();
+    };
+
+    BENCHMARK("Generator, AoS (float)")
+    {
+        generatorFloat.Generate(outFloat);
+        return outFloat.front();
+    };
+
+    BENCHMARK("Generator, SoA (float)")
+    {
+        generatorFloat.Generate(soa.View());
+        return soa.View().Load(0);
+    };
+
+    BENCHMARK("Perturbations within 0.1 rad (double)")
+    {
+        generator.Perturb(mean, 0.1, out);
+        return out.front();
+    };
+
+    BENCHMARK("Generator, AoS (double), all threads")
+    {
+        generator.Generate(out, 0, 0);
+        return out.front();
+    };
+}
@@ -0,0 +1,261 @@
+#include <QuaternionRing.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#if defined(QUATERNIONLIB_HAS_SHM)
+#include <unistd.h>
+
+// Producer and consumer run as threads with separate mappings and pipe ends, which exercises
+// the same paths as separate processes.
+namespace
+{
+    constexpr std::int64_t COUNT = 1 << 16;
+    constexpr std::size_t ROUND_TRIPS = 1000;
+
+    using quaternionlib::Quaternion;
+    using quaternionlib::RingRead;
+    using quaternionlib::SharedRingReader;
+    using quaternionlib::SharedRingWriter;
+    using quaternionlib::StampedQuaternion;
+
+    auto RingName(const char* suffix) -> std::string
+    {
+        return "/quaternionlib_bench_" + std::to_string(::getpid()) + "_" + suffix;
+    }
+
+    auto Sample(std::int64_t i) -> Quaternion<double>
+    {
+        const auto v = static_cast<double>(i);
+
+        return Quaternion<double>{v, -v, 0.5 * v, 1.0};
+    }
+
+    // Spins until the next record is read, yielding so a producer on the same core can run.
+    auto Receive(SharedRingReader<double>& reader) -> std::int64_t
+    {
+        std::int64_t timestamp = 0;
+
+        while (reader.Read([&](const StampedQuaternion<double>& record)
+                           { timestamp = record.timestamp; }) != RingRead::Ready)
+        {
+            std::this_thread::yield();
+        }
+
+        return timestamp;
+    }
+
+    auto WriteAll(int fd, const void* data, std::size_t size) -> void
+    {
+        const auto* bytes = static_cast<const char*>(data);
+
+        while (size > 0)
+        {
+            const auto written = ::write(fd, bytes, size);
+
+            if (written > 0)
+            {
+                bytes += written;
+                size -= static_cast<std::size_t>(written);
+            }
+        }
+    }
+
+    auto ReadAll(int fd, void* data, std::size_t size) -> void
+    {
+        auto* bytes = static_cast<char*>(data);
+
+        while (size > 0)
+        {
+            const auto read = ::read(fd, bytes, size);
+
+            if (read > 0)
+            {
+                bytes += read;
+                size -= static_cast<std::size_t>(read);
+            }
+        }
+    }
+
+    struct Pipe
+    {
+        Pipe()
+        {
+            REQUIRE(::pipe(fds) == 0);
+        }
+
+        ~Pipe()
+        {
+            ::close(fds[0]);
+            ::close(fds[1]);
+        }
+
+        int fds[2]{};
+    };
+} // namespace
+
+TEST_CASE("Shared memory ring throughput")
+{
+    const auto name = RingName("throughput");
+    SharedRingWriter<double> writer{name, COUNT};
+    SharedRingReader<double> reader{name};
+
+    BENCHMARK("Ring")
+    {
+        std::thread producer{[&]
+                             {
+                                 for (std::int64_t i = 0; i < COUNT; ++i)
+                                 {
+                                     writer.Publish(i, Sample(i));
+                                 }
+                             }};
+
+        std::int64_t last = 0;
+
+        for (std::int64_t i = 0; i < COUNT; ++i)
+        {
+            last = Receive(reader);
+        }
+
+        producer.join();
+
+        return last;
+    };
+
+    BENCHMARK("Pipe, binary records")
+    {
+        Pipe pipe;
+
+        std::thread producer{[&]
+                             {
+                                 for (std::int64_t i = 0; i < COUNT; ++i)
+                                 {
+                                     const auto q = Sample(i);
+                                     const StampedQuaternion<double> record{i, q.X(), q.Y(),
+                                                                            q.Z(), q.W()};
+                                     WriteAll(pipe.fds[1], &record, sizeof(record));
+                                 }
+                             }};
+
+        StampedQuaternion<double> record{};
+
+        for (std::int64_t i = 0; i < COUNT; ++i)
+        {
+            ReadAll(pipe.fds[0], &record, sizeof(record));
+        }
+
+        producer.join();
+
+        return record.timestamp;
+    };
+
+    BENCHMARK("Pipe, operator<< text")
+    {
+        Pipe pipe;
+        std::size_t total = 0;
+
+        for (std::int64_t i = 0; i < COUNT; ++i)
+        {
+            std::ostringstream line;
+            line << i << ' ' << Sample(i) << '\n';
+            total += line.str().size();
+        }
+
+        std::thread producer{[&]
+                             {
+                                 std::ostringstream line;
+
+                                 for (std::int64_t i = 0; i < COUNT; ++i)
+                                 {
+                                     line.str({});
+                                     line << i << ' ' << Sample(i) << '\n';
+                                     const auto text = line.str();
+                                     WriteAll(pipe.fds[1], text.data(), text.size());
+                                 }
+                             }};
+
+        char buffer[4096];
+
+        while (total > 0)
+        {
+            const auto read = ::read(pipe.fds[0], buffer, std::min(sizeof(buffer), total));
+
+            if (read > 0)
+            {
+                total -= static_cast<std::size_t>(read);
+            }
+        }
+
+        producer.join();
+
+        return buffer[0];
+    };
+}
+
+TEST_CASE("Shared memory ring latency")
+{
+    const auto pingName = RingName("ping");
+    const auto pongName = RingName("pong");
+    SharedRingWriter<double> pingWriter{pingName, 64};
+    SharedRingWriter<double> pongWriter{pongName, 64};
+    SharedRingReader<double> pingReader{pingName};
+    SharedRingReader<double> pongReader{pongName};
+
+    BENCHMARK("Ring, round trips")
+    {
+        std::thread echo{[&]
+                         {
+                             for (std::size_t i = 0; i < ROUND_TRIPS; ++i)
+                             {
+                                 const auto timestamp = Receive(pingReader);
+                                 pongWriter.Publish(timestamp, Sample(timestamp));
+                             }
+                         }};
+
+        std::int64_t last = 0;
+
+        for (std::size_t i = 0; i < ROUND_TRIPS; ++i)
+        {
+            pingWriter.Publish(static_cast<std::int64_t>(i), Sample(0));
+            last = Receive(pongReader);
+        }
+
+        echo.join();
+
+        return last;
+    };
+
+    BENCHMARK("Pipe, round trips")
+    {
+        Pipe ping;
+        Pipe pong;
+
+        std::thread echo{[&]
+                         {
+                             StampedQuaternion<double> record{};
+
+                             for (std::size_t i = 0; i < ROUND_TRIPS; ++i)
+                             {
+                                 ReadAll(ping.fds[0], &record, sizeof(record));
+                                 WriteAll(pong.fds[1], &record, sizeof(record));
+                             }
+                         }};
+
+        StampedQuaternion<double> record{};
+
+        for (std::size_t i = 0; i < ROUND_TRIPS; ++i)
+        {
+            record.timestamp = static_cast<std::int64_t>(i);
+            WriteAll(ping.fds[1], &record, sizeof(record));
+            ReadAll(pong.fds[0], &record, sizeof(record));
+        }
+
+        echo.join();
+
+        return record.timestamp;
+    };
+}
+#endif
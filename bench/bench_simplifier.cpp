@@ -0,0 +1,100 @@
+#include <AttitudeIntegrator.hpp>
+#include <AttitudeSimplifier.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t COUNT = 100000;
+    constexpr double TOLERANCE = 1e-3;
+
+    using quaternionlib::Keyframe;
+    using quaternionlib::Quaternion;
+} // namespace
+
+TEST_CASE("Attitude simplifier throughput")
+{
+    constexpr double dt = 0.01;
+
+    std::vector<double> times(COUNT);
+    std::vector<Quaternion<double>> samples(COUNT);
+    Quaternion<double> q{0.0, 0.0, 0.0, 1.0};
+
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        const double t = static_cast<double>(i) * dt;
+
+        times[i] = t;
+        samples[i] = q;
+        quaternionlib::IntegrateExponential(q, 0.8 * std::sin(0.5 * t), 0.3,
+                                            1.5 * std::cos(0.2 * t), dt);
+    }
+
+    std::vector<Keyframe<double>> keyframes;
+    quaternionlib::AttitudeSimplifier<double> simplifier{TOLERANCE};
+
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        if (const auto key = simplifier.Push(times[i], samples[i]))
+        {
+            keyframes.push_back(*key);
+        }
+    }
+
+    if (const auto key = simplifier.Flush())
+    {
+        keyframes.push_back(*key);
+    }
+
+    std::vector<Quaternion<double>> out(COUNT);
+    quaternionlib::QuaternionSoA<double> soa(COUNT);
+
+    BENCHMARK("Push")
+    {
+        quaternionlib::AttitudeSimplifier<double> stream{TOLERANCE};
+        std::size_t retained = 0;
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            retained += stream.Push(times[i], samples[i]).has_value();
+        }
+
+        return retained;
+    };
+
+    BENCHMARK("Slerp loop")
+    {
+        std::size_t segment = 0;
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            while (segment + 2 < keyframes.size() && times[i] >= keyframes[segment + 1].time)
+            {
+                ++segment;
+            }
+
+            const auto& from = keyframes[segment];
+            const auto& to = keyframes[segment + 1];
+            const double s = std::clamp((times[i] - from.time) / (to.time - from.time), 0.0, 1.0);
+
+            out[i] = quaternionlib::Slerp(from.orientation, to.orientation, s);
+        }
+
+        return out.back();
+    };
+
+    BENCHMARK("Reconstruct AoS")
+    {
+        quaternionlib::Reconstruct<double>(keyframes, times, out);
+        return out.back();
+    };
+
+    BENCHMARK("Reconstruct SoA")
+    {
+        quaternionlib::Reconstruct<double>(keyframes, times, soa.View());
+        return soa.View().Load(COUNT - 1);
+    };
+}
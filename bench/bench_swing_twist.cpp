@@ -0,0 +1,91 @@
+#include <QuaternionRandom.hpp>
+#include <QuaternionSwingTwist.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t COUNT = 4096;
+
+    using quaternionlib::PureQuaternion;
+    using quaternionlib::Quaternion;
+
+    // The usual clamp through angles: swing and twist angles from atan2, clamped, and the
+    // rotation rebuilt from sines and cosines.
+    auto ClampThroughAngles(const Quaternion<double>& q, const PureQuaternion<double>& axis,
+                            const quaternionlib::JointLimits<double>& limits) -> Quaternion<double>
+    {
+        const auto [swing, twist] = quaternionlib::DecomposeSwingTwist(q, axis);
+
+        const double twistSine = twist.X() * axis.X() + twist.Y() * axis.Y() + twist.Z() * axis.Z();
+        const double twistAngle = std::clamp(2 * std::atan2(twistSine, twist.W()),
+                                             limits.MinTwist(), limits.MaxTwist());
+
+        const double swingSine =
+            std::sqrt(swing.X() * swing.X() + swing.Y() * swing.Y() + swing.Z() * swing.Z());
+        const double swingAngle = std::min(2 * std::atan2(swingSine, swing.W()), limits.Cone());
+        const double scale = swingSine > 0 ? std::sin(swingAngle / 2) / swingSine : 0;
+
+        const Quaternion<double> clampedSwing{swing.X() * scale, swing.Y() * scale,
+                                              swing.Z() * scale, std::cos(swingAngle / 2)};
+        const double s = std::sin(twistAngle / 2);
+        const Quaternion<double> clampedTwist{axis.X() * s, axis.Y() * s, axis.Z() * s,
+                                              std::cos(twistAngle / 2)};
+
+        return clampedSwing * clampedTwist;
+    }
+} // namespace
+
+TEST_CASE("Joint limit throughput")
+{
+    std::vector<Quaternion<double>> points(COUNT);
+    quaternionlib::RandomRotationGenerator<double>{1}.Generate(points);
+
+    const PureQuaternion<double> axis{0.6, 0.0, 0.8};
+    const quaternionlib::JointLimits<double> limits{0.7, -0.4, 0.9};
+    const quaternionlib::QuaternionSoA<double> in{points};
+    quaternionlib::QuaternionSoA<double> out(COUNT);
+    quaternionlib::QuaternionSoA<double> twists(COUNT);
+    std::vector<Quaternion<double>> clamped(COUNT);
+
+    BENCHMARK("Through angles AoS")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            clamped[i] = ClampThroughAngles(points[i], axis, limits);
+        }
+
+        return clamped.front();
+    };
+
+    BENCHMARK("ClampJoint AoS")
+    {
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            clamped[i] = quaternionlib::ClampJoint(points[i], axis, limits);
+        }
+
+        return clamped.front();
+    };
+
+    BENCHMARK("ClampJoints AoS")
+    {
+        quaternionlib::ClampJoints<double>(points, axis, limits, clamped);
+        return clamped.front();
+    };
+
+    BENCHMARK("ClampJoints SoA")
+    {
+        quaternionlib::ClampJoints<double>(in.View(), axis, limits, out.View());
+        return out.View().Load(0);
+    };
+
+    BENCHMARK("DecomposeSwingTwist SoA")
+    {
+        quaternionlib::DecomposeSwingTwist<double>(in.View(), axis, out.View(), twists.View());
+        return twists.View().Load(0);
+    };
+}
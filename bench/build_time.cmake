@@ -0,0 +1,172 @@
+# Build-time benchmark: compiles the same generated consumer translation units against the plain
+# headers, against the explicit instantiation library and, when available, through the module.
+#
+#   cmake [-DUNITS=24] [-DCONFIG=Debug] [-DJOBS=N] [-DMODULE=ON] [-DGENERATOR=Ninja]
+#         [-DBUILD_DIR=<dir>] -P bench/build_time.cmake
+#
+# Reports the clean build of all units and the rebuild after touching a single unit, excluding
+# the one-off cost of building the libraries themselves.
+cmake_minimum_required(VERSION 3.23)
+
+get_filename_component(SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+
+if(NOT DEFINED UNITS)
+    set(UNITS 24)
+endif()
+
+if(NOT DEFINED CONFIG)
+    set(CONFIG Debug)
+endif()
+
+if(NOT DEFINED JOBS)
+    cmake_host_system_information(RESULT JOBS QUERY NUMBER_OF_LOGICAL_CORES)
+endif()
+
+if(NOT DEFINED BUILD_DIR)
+    set(BUILD_DIR "${CMAKE_CURRENT_BINARY_DIR}/build_time")
+endif()
+
+set(VARIANTS headers instantiated)
+
+if(MODULE)
+    if(CMAKE_VERSION VERSION_LESS 3.28)
+        message(FATAL_ERROR "The module variant requires CMake 3.28 or newer.")
+    endif()
+
+    list(APPEND VARIANTS module)
+endif()
+
+file(REMOVE_RECURSE "${BUILD_DIR}")
+
+set(INCLUDES [=[
+#include <AttitudeIntegrator.hpp>
+#include <QuaternionDistance.hpp>
+#include <QuaternionFormat.hpp>
+#include <QuaternionParse.hpp>
+#include <QuaternionRandom.hpp>
+]=])
+
+set(STANDARD_INCLUDES [=[
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+]=])
+
+set(BODY [=[
+
+auto Unit@index@() -> double
+{
+    using quaternionlib::Quaternion;
+
+    std::vector<Quaternion<double>> q(16);
+    quaternionlib::RandomRotationGenerator<double>{@index@}.Generate(q);
+
+    quaternionlib::QuaternionSoA<double> soa{q};
+    std::vector<double> w(q.size(), 0.5);
+    const quaternionlib::Vector3SoASpan<const double> omega{w, w, w};
+    quaternionlib::IntegrateRK4(soa.View(), omega, 0.01);
+
+    std::vector<double> distances(q.size());
+    quaternionlib::Distances<double>(q[0], q, distances);
+
+    char text[4096];
+    const auto written = quaternionlib::WriteCsv<double>(q, text);
+    const auto parsed = quaternionlib::ParseText<double>(
+        std::string_view{text, static_cast<std::size_t>(written.ptr - text)});
+
+    const auto product = (q[0] * q[1] + q[2] * 2.0).Normalized();
+
+    return distances.back() + product.W() + static_cast<double>(parsed.size());
+}
+]=])
+
+foreach(variant IN LISTS VARIANTS)
+    foreach(index RANGE 1 ${UNITS})
+        if(variant STREQUAL "module")
+            set(unit "${STANDARD_INCLUDES}\nimport quaternionlib;\n${BODY}")
+        else()
+            set(unit "${INCLUDES}${STANDARD_INCLUDES}${BODY}")
+        endif()
+
+        string(CONFIGURE "${unit}" unit @ONLY)
+        file(WRITE "${BUILD_DIR}/project/${variant}/unit_${index}.cpp" "${unit}")
+    endforeach()
+endforeach()
+
+file(WRITE "${BUILD_DIR}/project/CMakeLists.txt" "
+cmake_minimum_required(VERSION 3.20)
+project(quaternion_lib_build_time CXX)
+
+set(CMAKE_CXX_STANDARD 23)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+
+find_package(Threads REQUIRED)
+
+add_library(library INTERFACE)
+target_include_directories(library INTERFACE \"${SOURCE_DIR}/include\")
+target_link_libraries(library INTERFACE Threads::Threads)
+
+add_library(instantiations STATIC \"${SOURCE_DIR}/src/QuaternionInstantiations.cpp\")
+target_link_libraries(instantiations PUBLIC library)
+target_compile_definitions(instantiations PUBLIC QUATERNIONLIB_EXTERN_TEMPLATES)
+
+file(GLOB headers_units headers/*.cpp)
+add_library(headers OBJECT \${headers_units})
+target_link_libraries(headers PRIVATE library)
+
+file(GLOB instantiated_units instantiated/*.cpp)
+add_library(instantiated OBJECT \${instantiated_units})
+target_link_libraries(instantiated PRIVATE instantiations)
+
+if(MODULE)
+    add_library(interface)
+    target_sources(interface PUBLIC FILE_SET CXX_MODULES BASE_DIRS \"${SOURCE_DIR}/src\"
+                   FILES \"${SOURCE_DIR}/src/quaternionlib.cppm\")
+    target_link_libraries(interface PUBLIC instantiations)
+
+    file(GLOB module_units module/*.cpp)
+    add_library(module OBJECT \${module_units})
+    target_link_libraries(module PRIVATE interface)
+endif()
+")
+
+set(configure_args -S "${BUILD_DIR}/project" -B "${BUILD_DIR}/build"
+                   -DCMAKE_BUILD_TYPE=${CONFIG} -DMODULE=${MODULE})
+
+if(DEFINED GENERATOR)
+    list(APPEND configure_args -G "${GENERATOR}")
+endif()
+
+execute_process(COMMAND "${CMAKE_COMMAND}" ${configure_args} OUTPUT_QUIET
+                COMMAND_ERROR_IS_FATAL ANY)
+
+function(timed_build target result)
+    string(TIMESTAMP start "%s%f")
+    execute_process(COMMAND "${CMAKE_COMMAND}" --build "${BUILD_DIR}/build" --config ${CONFIG}
+                            --target ${target} -j ${JOBS}
+                    OUTPUT_QUIET COMMAND_ERROR_IS_FATAL ANY)
+    string(TIMESTAMP stop "%s%f")
+    math(EXPR elapsed "(${stop} - ${start}) / 1000")
+    set(${result} ${elapsed} PARENT_SCOPE)
+endfunction()
+
+set(libraries instantiations)
+
+if(MODULE)
+    list(APPEND libraries interface)
+endif()
+
+timed_build("${libraries}" library_ms)
+message(STATUS "One-off library build: ${library_ms} ms")
+message(STATUS "${UNITS} units, ${CONFIG}, ${JOBS} jobs")
+
+foreach(variant IN LISTS VARIANTS)
+    timed_build(${variant} clean_ms)
+    file(TOUCH "${BUILD_DIR}/project/${variant}/unit_1.cpp")
+    timed_build(${variant} incremental_ms)
+
+    math(EXPR unit_ms "${clean_ms} / ${UNITS}")
+    message(STATUS "${variant}: clean ${clean_ms} ms (${unit_ms} ms per unit), "
+                   "one unit touched ${incremental_ms} ms")
+endforeach()
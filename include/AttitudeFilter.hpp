@@ -0,0 +1,299 @@
+#ifndef QUATERNIONLIB_ATTITUDEFILTER_HPP
+#define QUATERNIONLIB_ATTITUDEFILTER_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Banks of independent IMU attitude filters (gyroscope + accelerometer) updated in one call.
+// Orientations map the sensor frame to the earth frame, gyroscope rates are in rad/s.
+namespace quaternionlib
+{
+    namespace details
+    {
+        template <std::floating_point T>
+        auto MadgwickBlock(StagedBlock<T>& q, Vector3SoASpan<const T> gyro,
+                           Vector3SoASpan<const T> accel, T beta, T dt) noexcept -> void
+        {
+            for (std::size_t i = 0; i < q.size; ++i)
+            {
+                const T q0 = q.w[i];
+                const T q1 = q.x[i];
+                const T q2 = q.y[i];
+                const T q3 = q.z[i];
+
+                const T gx = gyro.x[i];
+                const T gy = gyro.y[i];
+                const T gz = gyro.z[i];
+
+                T qDot0 = (-q1 * gx - q2 * gy - q3 * gz) / 2;
+                T qDot1 = (q0 * gx + q2 * gz - q3 * gy) / 2;
+                T qDot2 = (q0 * gy - q1 * gz + q3 * gx) / 2;
+                T qDot3 = (q0 * gz + q1 * gy - q2 * gx) / 2;
+
+                const T accelNorm2 =
+                    accel.x[i] * accel.x[i] + accel.y[i] * accel.y[i] + accel.z[i] * accel.z[i];
+                const T accelInverse = FastInverseSqrt(accelNorm2);
+                const T ax = accel.x[i] * accelInverse;
+                const T ay = accel.y[i] * accelInverse;
+                const T az = accel.z[i] * accelInverse;
+
+                // Gradient descent step towards aligning the estimated gravity with the
+                // measured one; skipped (masked) when the accelerometer reads zero.
+                const T q0q0 = q0 * q0;
+                const T q1q1 = q1 * q1;
+                const T q2q2 = q2 * q2;
+                const T q3q3 = q3 * q3;
+
+                const T s0 = 4 * q0 * q2q2 + 2 * q2 * ax + 4 * q0 * q1q1 - 2 * q1 * ay;
+                const T s1 = 4 * q1 * q3q3 - 2 * q3 * ax + 4 * q0q0 * q1 - 2 * q0 * ay - 4 * q1 +
+                             8 * q1 * q1q1 + 8 * q1 * q2q2 + 4 * q1 * az;
+                const T s2 = 4 * q0q0 * q2 + 2 * q0 * ax + 4 * q2 * q3q3 - 2 * q3 * ay - 4 * q2 +
+                             8 * q2 * q1q1 + 8 * q2 * q2q2 + 4 * q2 * az;
+                const T s3 = 4 * q1q1 * q3 - 2 * q1 * ax + 4 * q2q2 * q3 - 2 * q2 * ay;
+
+                const T step = (accelNorm2 > 0 ? beta : T{}) *
+                               FastInverseSqrt(s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3);
+
+                qDot0 -= step * s0;
+                qDot1 -= step * s1;
+                qDot2 -= step * s2;
+                qDot3 -= step * s3;
+
+                const T r0 = q0 + qDot0 * dt;
+                const T r1 = q1 + qDot1 * dt;
+                const T r2 = q2 + qDot2 * dt;
+                const T r3 = q3 + qDot3 * dt;
+
+                const T inverseNorm = FastInverseSqrt(r0 * r0 + r1 * r1 + r2 * r2 + r3 * r3);
+
+                q.w[i] = r0 * inverseNorm;
+                q.x[i] = r1 * inverseNorm;
+                q.y[i] = r2 * inverseNorm;
+                q.z[i] = r3 * inverseNorm;
+            }
+        }
+
+        template <std::floating_point T>
+        auto MahonyBlock(StagedBlock<T>& q, T* integralX, T* integralY, T* integralZ,
+                         Vector3SoASpan<const T> gyro, Vector3SoASpan<const T> accel, T kp, T ki,
+                         T dt) noexcept -> void
+        {
+            for (std::size_t i = 0; i < q.size; ++i)
+            {
+                const T q0 = q.w[i];
+                const T q1 = q.x[i];
+                const T q2 = q.y[i];
+                const T q3 = q.z[i];
+
+                const T accelNorm2 =
+                    accel.x[i] * accel.x[i] + accel.y[i] * accel.y[i] + accel.z[i] * accel.z[i];
+                const T accelInverse = FastInverseSqrt(accelNorm2);
+                const T ax = accel.x[i] * accelInverse;
+                const T ay = accel.y[i] * accelInverse;
+                const T az = accel.z[i] * accelInverse;
+
+                // Half of the estimated gravity direction in the sensor frame
+                const T halfVx = q1 * q3 - q0 * q2;
+                const T halfVy = q0 * q1 + q2 * q3;
+                const T halfVz = q0 * q0 - static_cast<T>(0.5) + q3 * q3;
+
+                // Error is the cross product between measured and estimated gravity,
+                // zero when the accelerometer reads zero.
+                const T ex = ay * halfVz - az * halfVy;
+                const T ey = az * halfVx - ax * halfVz;
+                const T ez = ax * halfVy - ay * halfVx;
+
+                integralX[i] += 2 * ki * ex * dt;
+                integralY[i] += 2 * ki * ey * dt;
+                integralZ[i] += 2 * ki * ez * dt;
+
+                const T gx = (gyro.x[i] + integralX[i] + 2 * kp * ex) * dt / 2;
+                const T gy = (gyro.y[i] + integralY[i] + 2 * kp * ey) * dt / 2;
+                const T gz = (gyro.z[i] + integralZ[i] + 2 * kp * ez) * dt / 2;
+
+                const T r0 = q0 + (-q1 * gx - q2 * gy - q3 * gz);
+                const T r1 = q1 + (q0 * gx + q2 * gz - q3 * gy);
+                const T r2 = q2 + (q0 * gy - q1 * gz + q3 * gx);
+                const T r3 = q3 + (q0 * gz + q1 * gy - q2 * gx);
+
+                const T inverseNorm = FastInverseSqrt(r0 * r0 + r1 * r1 + r2 * r2 + r3 * r3);
+
+                q.w[i] = r0 * inverseNorm;
+                q.x[i] = r1 * inverseNorm;
+                q.y[i] = r2 * inverseNorm;
+                q.z[i] = r3 * inverseNorm;
+            }
+        }
+    } // namespace details
+
+    template <std::floating_point T>
+    class MadgwickFilterBank final
+    {
+    public:
+        explicit MadgwickFilterBank(std::size_t devices, T beta = static_cast<T>(0.1))
+            : _orientations(devices), _beta(beta)
+        {
+            std::fill_n(_orientations.View().w.begin(), devices, static_cast<T>(1));
+        }
+
+        [[nodiscard]] auto Size() const noexcept -> std::size_t
+        {
+            return _orientations.Size();
+        }
+
+        [[nodiscard]] auto Beta() const noexcept -> T
+        {
+            return _beta;
+        }
+
+        auto SetBeta(T beta) noexcept -> void
+        {
+            _beta = beta;
+        }
+
+        [[nodiscard]] auto Orientations() const noexcept -> QuaternionSoASpan<const T>
+        {
+            return _orientations.View();
+        }
+
+        [[nodiscard]] auto Orientation(std::size_t device) const noexcept -> Quaternion<T>
+        {
+            return _orientations.View().Load(device);
+        }
+
+        auto SetOrientation(std::size_t device, const Quaternion<T>& q) noexcept -> void
+        {
+            _orientations.View().Store(device, q);
+        }
+
+        // One sample per device; all spans must have Size() elements.
+        auto Update(Vector3SoASpan<const T> gyro, Vector3SoASpan<const T> accel, T dt,
+                    std::size_t threads = 1) -> void
+        {
+            assert(gyro.Size() == Size() && accel.Size() == Size());
+
+            const auto q = _orientations.View();
+
+            details::ForEachBlock(Size(), threads, details::BATCH_MIN_CHUNK,
+                                  [&](std::size_t offset, std::size_t count)
+                                  {
+                                      const auto target = q.Subspan(offset, count);
+                                      details::StagedBlock<T> block{target};
+
+                                      details::MadgwickBlock(block, gyro.Subspan(offset, count),
+                                                             accel.Subspan(offset, count), _beta,
+                                                             dt);
+                                      block.StoreTo(target);
+                                  });
+        }
+
+    private:
+        QuaternionSoA<T> _orientations;
+        T _beta;
+    };
+
+    template <std::floating_point T>
+    class MahonyFilterBank final
+    {
+    public:
+        explicit MahonyFilterBank(std::size_t devices, T kp = static_cast<T>(1),
+                                  T ki = static_cast<T>(0))
+            : _orientations(devices), _integralX(devices), _integralY(devices),
+              _integralZ(devices), _kp(kp), _ki(ki)
+        {
+            std::fill_n(_orientations.View().w.begin(), devices, static_cast<T>(1));
+        }
+
+        [[nodiscard]] auto Size() const noexcept -> std::size_t
+        {
+            return _orientations.Size();
+        }
+
+        auto SetGains(T kp, T ki) noexcept -> void
+        {
+            _kp = kp;
+            _ki = ki;
+        }
+
+        [[nodiscard]] auto Orientations() const noexcept -> QuaternionSoASpan<const T>
+        {
+            return _orientations.View();
+        }
+
+        [[nodiscard]] auto Orientation(std::size_t device) const noexcept -> Quaternion<T>
+        {
+            return _orientations.View().Load(device);
+        }
+
+        auto SetOrientation(std::size_t device, const Quaternion<T>& q) noexcept -> void
+        {
+            _orientations.View().Store(device, q);
+            _integralX[device] = T{};
+            _integralY[device] = T{};
+            _integralZ[device] = T{};
+        }
+
+        // Integral feedback, i.e. the current gyroscope bias estimate of each device.
+        [[nodiscard]] auto Integrals() const noexcept -> Vector3SoASpan<const T>
+        {
+            return {_integralX, _integralY, _integralZ};
+        }
+
+        // One sample per device; all spans must have Size() elements.
+        auto Update(Vector3SoASpan<const T> gyro, Vector3SoASpan<const T> accel, T dt,
+                    std::size_t threads = 1) -> void
+        {
+            assert(gyro.Size() == Size() && accel.Size() == Size());
+
+            const auto q = _orientations.View();
+
+            details::ForEachBlock(
+                Size(), threads, details::BATCH_MIN_CHUNK,
+                [&](std::size_t offset, std::size_t count)
+                {
+                    const auto target = q.Subspan(offset, count);
+                    details::StagedBlock<T> block{target};
+                    T ix[details::BATCH_BLOCK];
+                    T iy[details::BATCH_BLOCK];
+                    T iz[details::BATCH_BLOCK];
+
+                    std::copy_n(_integralX.data() + offset, count, ix);
+                    std::copy_n(_integralY.data() + offset, count, iy);
+                    std::copy_n(_integralZ.data() + offset, count, iz);
+
+                    details::MahonyBlock(block, ix, iy, iz, gyro.Subspan(offset, count),
+                                         accel.Subspan(offset, count), _kp, _ki, dt);
+
+                    block.StoreTo(target);
+                    std::copy_n(ix, count, _integralX.data() + offset);
+                    std::copy_n(iy, count, _integralY.data() + offset);
+                    std::copy_n(iz, count, _integralZ.data() + offset);
+                });
+        }
+
+    private:
+        QuaternionSoA<T> _orientations;
+        std::vector<T> _integralX, _integralY, _integralZ;
+        T _kp, _ki;
+    };
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_FILTER(EXTERN, T)                                                \
+    EXTERN template class MadgwickFilterBank<T>;                                                   \
+    EXTERN template class MahonyFilterBank<T>;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_FILTER(extern, float)
+    QUATERNIONLIB_INSTANTIATE_FILTER(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_ATTITUDEFILTER_HPP
@@ -0,0 +1,328 @@
+#ifndef QUATERNIONLIB_ATTITUDEINTEGRATOR_HPP
+#define QUATERNIONLIB_ATTITUDEINTEGRATOR_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionAccumulator.hpp"
+#include "QuaternionBatch.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+// Attitude propagation for body-frame angular velocities: dq/dt = 1/2 * q * (omega, 0).
+namespace quaternionlib
+{
+    namespace details
+    {
+        // Half-angles up to this value use the polynomial path, beyond it std::sin/std::cos.
+        template <typename T>
+        static inline constexpr T MAX_POLYNOMIAL_HALF_ANGLE = static_cast<T>(0.5);
+
+        // cos(t) and sin(t) / t as polynomials in u = t * t, accurate to rounding for
+        // t <= MAX_POLYNOMIAL_HALF_ANGLE. Branch-free so loops over it vectorize.
+        template <std::floating_point T>
+        constexpr auto CosSincPolynomial(T u, T& c, T& s) noexcept -> void
+        {
+            c = static_cast<T>(1);
+            s = static_cast<T>(1);
+
+            for (int k = 7; k >= 1; --k)
+            {
+                c = static_cast<T>(1) - u / static_cast<T>((2 * k - 1) * (2 * k)) * c;
+                s = static_cast<T>(1) - u / static_cast<T>((2 * k) * (2 * k + 1)) * s;
+            }
+        }
+
+        template <std::floating_point T>
+        auto CosSinc(T u, T& c, T& s) noexcept -> void
+        {
+            const T t = std::sqrt(u);
+
+            c = std::cos(t);
+            s = std::sin(t) / t;
+        }
+
+        // Rotation increment exp(omega * dt / 2), written as (omega * k, c).
+        template <std::floating_point T>
+        auto ExponentialIncrement(T wx, T wy, T wz, T dt, T& k, T& c) noexcept -> void
+        {
+            const T h = dt / 2;
+            const T u = (wx * wx + wy * wy + wz * wz) * h * h;
+
+            if (u <= MAX_POLYNOMIAL_HALF_ANGLE<T> * MAX_POLYNOMIAL_HALF_ANGLE<T>)
+            {
+                CosSincPolynomial(u, c, k);
+            }
+            else
+            {
+                CosSinc(u, c, k);
+            }
+
+            k *= h;
+        }
+
+        // q * (vx, vy, vz, vw)
+        template <std::floating_point T>
+        constexpr auto Compose(T& x, T& y, T& z, T& w, T vx, T vy, T vz, T vw) noexcept -> void
+        {
+            const T x1 = x;
+            const T y1 = y;
+            const T z1 = z;
+            const T w1 = w;
+
+            x = w1 * vx + x1 * vw + y1 * vz - z1 * vy;
+            y = w1 * vy - x1 * vz + y1 * vw + z1 * vx;
+            z = w1 * vz + x1 * vy - y1 * vx + z1 * vw;
+            w = w1 * vw - x1 * vx - y1 * vy - z1 * vz;
+        }
+
+        // 1/2 * q * (v, 0)
+        template <std::floating_point T>
+        constexpr auto Derivative(T x, T y, T z, T w, T vx, T vy, T vz, T& dx, T& dy, T& dz,
+                                  T& dw) noexcept -> void
+        {
+            dx = (w * vx + y * vz - z * vy) / 2;
+            dy = (w * vy - x * vz + z * vx) / 2;
+            dz = (w * vz + x * vy - y * vx) / 2;
+            dw = -(x * vx + y * vy + z * vz) / 2;
+        }
+
+        template <std::floating_point T>
+        auto IntegrateExponentialBlock(StagedBlock<T>& block, Vector3SoASpan<const T> omega,
+                                       T dt) noexcept -> void
+        {
+            assert(block.size == omega.Size());
+
+            const std::size_t n = block.size;
+            const T h = dt / 2;
+            constexpr T limit = MAX_POLYNOMIAL_HALF_ANGLE<T> * MAX_POLYNOMIAL_HALF_ANGLE<T>;
+
+            T u[BATCH_BLOCK];
+            T k[BATCH_BLOCK];
+            T c[BATCH_BLOCK];
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                u[i] = (omega.x[i] * omega.x[i] + omega.y[i] * omega.y[i] +
+                        omega.z[i] * omega.z[i]) *
+                       h * h;
+                CosSincPolynomial(u[i], c[i], k[i]);
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (u[i] > limit) [[unlikely]]
+                {
+                    CosSinc(u[i], c[i], k[i]);
+                }
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const T s = k[i] * h;
+
+                Compose(block.x[i], block.y[i], block.z[i], block.w[i], omega.x[i] * s,
+                        omega.y[i] * s, omega.z[i] * s, c[i]);
+            }
+        }
+
+        // Expects unit quaternions on input.
+        template <std::floating_point T>
+        auto IntegrateRK4Block(StagedBlock<T>& block, Vector3SoASpan<const T> omegaBegin,
+                               Vector3SoASpan<const T> omegaEnd, T dt) noexcept -> void
+        {
+            assert(block.size == omegaBegin.Size() && block.size == omegaEnd.Size());
+
+            const std::size_t n = block.size;
+            const T h = dt / 2;
+            const T sixth = dt / 6;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const T x = block.x[i];
+                const T y = block.y[i];
+                const T z = block.z[i];
+                const T w = block.w[i];
+
+                const T ax = omegaBegin.x[i];
+                const T ay = omegaBegin.y[i];
+                const T az = omegaBegin.z[i];
+                const T bx = omegaEnd.x[i];
+                const T by = omegaEnd.y[i];
+                const T bz = omegaEnd.z[i];
+                const T mx = (ax + bx) / 2;
+                const T my = (ay + by) / 2;
+                const T mz = (az + bz) / 2;
+
+                T k1x, k1y, k1z, k1w;
+                T k2x, k2y, k2z, k2w;
+                T k3x, k3y, k3z, k3w;
+                T k4x, k4y, k4z, k4w;
+
+                Derivative(x, y, z, w, ax, ay, az, k1x, k1y, k1z, k1w);
+                Derivative(x + h * k1x, y + h * k1y, z + h * k1z, w + h * k1w, mx, my, mz, k2x,
+                           k2y, k2z, k2w);
+                Derivative(x + h * k2x, y + h * k2y, z + h * k2z, w + h * k2w, mx, my, mz, k3x,
+                           k3y, k3z, k3w);
+                Derivative(x + dt * k3x, y + dt * k3y, z + dt * k3z, w + dt * k3w, bx, by, bz, k4x,
+                           k4y, k4z, k4w);
+
+                const T rx = x + sixth * (k1x + 2 * k2x + 2 * k3x + k4x);
+                const T ry = y + sixth * (k1y + 2 * k2y + 2 * k3y + k4y);
+                const T rz = z + sixth * (k1z + 2 * k2z + 2 * k3z + k4z);
+                const T rw = w + sixth * (k1w + 2 * k2w + 2 * k3w + k4w);
+
+                // RK4 leaves the unit sphere by O(dt^5) per step. One Newton step of 1/sqrt
+                // starting from 1 projects back to second order without a sqrt or division.
+                const T correction = (3 - (rx * rx + ry * ry + rz * rz + rw * rw)) / 2;
+
+                block.x[i] = rx * correction;
+                block.y[i] = ry * correction;
+                block.z[i] = rz * correction;
+                block.w[i] = rw * correction;
+            }
+        }
+
+        // Runs kernel(block, offset, count) on staged blocks of q and writes them back.
+        template <std::floating_point T, typename Target, typename Kernel>
+        auto UpdateBlocks(Target q, std::size_t threads, Kernel&& kernel) -> void
+        {
+            ForEachBlock(BatchSize(q), threads, BATCH_MIN_CHUNK,
+                         [&](std::size_t offset, std::size_t count)
+                         {
+                             const auto target = BatchSlice(q, offset, count);
+                             StagedBlock<T> block{target};
+
+                             kernel(block, offset, count);
+                             block.StoreTo(target);
+                         });
+        }
+
+        template <std::floating_point T, typename Target>
+        auto IntegrateExponential(Target q, Vector3SoASpan<const T> omega, T dt,
+                                  std::size_t threads) -> void
+        {
+            assert(BatchSize(q) == omega.Size());
+
+            UpdateBlocks<T>(q, threads,
+                            [&](StagedBlock<T>& block, std::size_t offset, std::size_t count)
+                            {
+                                IntegrateExponentialBlock(block, omega.Subspan(offset, count),
+                                                          dt);
+                            });
+        }
+
+        template <std::floating_point T, typename Target>
+        auto IntegrateRK4(Target q, Vector3SoASpan<const T> omegaBegin,
+                          Vector3SoASpan<const T> omegaEnd, T dt, std::size_t threads) -> void
+        {
+            assert(BatchSize(q) == omegaBegin.Size() && BatchSize(q) == omegaEnd.Size());
+
+            UpdateBlocks<T>(q, threads,
+                            [&](StagedBlock<T>& block, std::size_t offset, std::size_t count)
+                            {
+                                IntegrateRK4Block(block, omegaBegin.Subspan(offset, count),
+                                                  omegaEnd.Subspan(offset, count), dt);
+                            });
+        }
+    } // namespace details
+
+    // Advances q by one step of constant body angular velocity using the exponential map.
+    // The increment is an exact unit quaternion, so no renormalization is needed.
+    template <std::floating_point T>
+    auto IntegrateExponential(Quaternion<T>& q, T wx, T wy, T wz, T dt) noexcept -> void
+    {
+        T k{}, c{};
+        details::ExponentialIncrement(wx, wy, wz, dt, k, c);
+
+        q *= Quaternion<T>{wx * k, wy * k, wz * k, c};
+    }
+
+    // The same step composed in double-length arithmetic, for runs of millions of steps.
+    template <std::floating_point T>
+    auto IntegrateExponential(RotationAccumulator<T>& q, T wx, T wy, T wz, T dt) noexcept -> void
+    {
+        T k{}, c{};
+        details::ExponentialIncrement(wx, wy, wz, dt, k, c);
+
+        q *= Quaternion<T>{wx * k, wy * k, wz * k, c};
+    }
+
+    // Classic RK4 step with the angular velocity varying linearly over the step. The result is
+    // projected back onto the unit sphere, which assumes q is a unit quaternion.
+    template <std::floating_point T>
+    auto IntegrateRK4(Quaternion<T>& q, T ax, T ay, T az, T bx, T by, T bz, T dt) noexcept -> void
+    {
+        details::StagedBlock<T> block{std::span<const Quaternion<T>>{&q, 1}};
+
+        details::IntegrateRK4Block(block, Vector3SoASpan<const T>{{&ax, 1}, {&ay, 1}, {&az, 1}},
+                                   Vector3SoASpan<const T>{{&bx, 1}, {&by, 1}, {&bz, 1}}, dt);
+        block.StoreTo(std::span<Quaternion<T>>{&q, 1});
+    }
+
+    template <std::floating_point T>
+    auto IntegrateExponential(QuaternionSoASpan<T> q, Vector3SoASpan<const T> omega, T dt,
+                              std::size_t threads = 1) -> void
+    {
+        details::IntegrateExponential(q, omega, dt, threads);
+    }
+
+    // Integrates quaternions in place in a foreign buffer.
+    template <std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    auto IntegrateExponential(QuaternionStridedView<T, Order, Stride> q,
+                              Vector3SoASpan<const T> omega, T dt, std::size_t threads = 1) -> void
+    {
+        details::IntegrateExponential(q, omega, dt, threads);
+    }
+
+    template <std::floating_point T>
+    auto IntegrateRK4(QuaternionSoASpan<T> q, Vector3SoASpan<const T> omegaBegin,
+                      Vector3SoASpan<const T> omegaEnd, T dt, std::size_t threads = 1) -> void
+    {
+        details::IntegrateRK4(q, omegaBegin, omegaEnd, dt, threads);
+    }
+
+    template <std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    auto IntegrateRK4(QuaternionStridedView<T, Order, Stride> q,
+                      Vector3SoASpan<const T> omegaBegin, Vector3SoASpan<const T> omegaEnd, T dt,
+                      std::size_t threads = 1) -> void
+    {
+        details::IntegrateRK4(q, omegaBegin, omegaEnd, dt, threads);
+    }
+
+    template <std::floating_point T>
+    auto IntegrateRK4(QuaternionSoASpan<T> q, Vector3SoASpan<const T> omega, T dt,
+                      std::size_t threads = 1) -> void
+    {
+        details::IntegrateRK4(q, omega, omega, dt, threads);
+    }
+
+    template <std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    auto IntegrateRK4(QuaternionStridedView<T, Order, Stride> q, Vector3SoASpan<const T> omega,
+                      T dt, std::size_t threads = 1) -> void
+    {
+        details::IntegrateRK4(q, omega, omega, dt, threads);
+    }
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_INTEGRATOR(EXTERN, T)                                            \
+    EXTERN template auto IntegrateExponential<T>(Quaternion<T>&, T, T, T, T) noexcept -> void;     \
+    EXTERN template auto IntegrateExponential<T>(RotationAccumulator<T>&, T, T, T, T) noexcept     \
+        -> void;                                                                                   \
+    EXTERN template auto IntegrateRK4<T>(Quaternion<T>&, T, T, T, T, T, T, T) noexcept -> void;    \
+    EXTERN template auto IntegrateExponential<T>(QuaternionSoASpan<T>, Vector3SoASpan<const T>, T, \
+                                                 std::size_t) -> void;                             \
+    EXTERN template auto IntegrateRK4<T>(QuaternionSoASpan<T>, Vector3SoASpan<const T>,            \
+                                         Vector3SoASpan<const T>, T, std::size_t) -> void;         \
+    EXTERN template auto IntegrateRK4<T>(QuaternionSoASpan<T>, Vector3SoASpan<const T>, T,         \
+                                         std::size_t) -> void;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_INTEGRATOR(extern, float)
+    QUATERNIONLIB_INSTANTIATE_INTEGRATOR(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_ATTITUDEINTEGRATOR_HPP
@@ -0,0 +1,347 @@
+#ifndef QUATERNIONLIB_ATTITUDESIMPLIFIER_HPP
+#define QUATERNIONLIB_ATTITUDESIMPLIFIER_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "QuaternionDistance.hpp"
+#include "QuaternionSparse.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <stdexcept>
+
+// Lossy compression of orientation streams into keyframes, with a guaranteed bound on the angle
+// between every dropped sample and the Slerp of the keyframes around it.
+namespace quaternionlib
+{
+    template <std::floating_point T>
+    struct Keyframe
+    {
+        double time;
+        Quaternion<T> orientation;
+    };
+
+    // Online simplifier in O(1) memory. Each segment starts at a keyframe K; sample q at time t
+    // constrains the segment's angular velocity w, in the tangent space at K, to the ball
+    // |w - Log(K^-1 q) / (t - t0)| <= tolerance / (t - t0). The exponential map of SO(3) does
+    // not stretch distances, so any w in every ball keeps all samples within tolerance. Only a
+    // ball inscribed in the intersection is kept; a sample disjoint from it closes the segment.
+    template <std::floating_point T>
+    class AttitudeSimplifier final
+    {
+    public:
+        // tolerance in radians, the largest rotation angle between a sample and its
+        // reconstruction.
+        explicit AttitudeSimplifier(T tolerance)
+            : _tolerance(tolerance)
+        {
+            if (!(tolerance >= 0))
+            {
+                throw std::invalid_argument("Tolerance must be a non-negative angle.");
+            }
+        }
+
+        [[nodiscard]] auto Tolerance() const noexcept -> T
+        {
+            return _tolerance;
+        }
+
+        // Unit quaternion samples with strictly increasing times. The first sample of a stream
+        // is returned as a keyframe; later ones return the keyframe ending the previous segment
+        // when they cannot join it.
+        [[nodiscard]] auto Push(double time, const Quaternion<T>& q) -> std::optional<Keyframe<T>>
+        {
+            if (!_started)
+            {
+                _started = true;
+                _key = Keyframe<T>{time, q};
+                _lastTime = time;
+
+                return _key;
+            }
+
+            if (!(time > _lastTime))
+            {
+                throw std::invalid_argument("Sample times must be strictly increasing.");
+            }
+
+            std::optional<Keyframe<T>> closed;
+
+            if (_pending)
+            {
+                if (Intersect(Constraint(time, q), static_cast<T>(time - _key.time)))
+                {
+                    _lastTime = time;
+
+                    return std::nullopt;
+                }
+
+                closed = SegmentEnd();
+                _key = *closed;
+            }
+
+            _feasible = Constraint(time, q);
+            _pending = true;
+            _lastTime = time;
+
+            return closed;
+        }
+
+        // Ends the stream, returning the keyframe at its last sample unless that already is one.
+        [[nodiscard]] auto Flush() noexcept -> std::optional<Keyframe<T>>
+        {
+            std::optional<Keyframe<T>> last;
+
+            if (_pending)
+            {
+                last = SegmentEnd();
+            }
+
+            _started = false;
+            _pending = false;
+
+            return last;
+        }
+
+    private:
+        struct Ball
+        {
+            T x, y, z, radius;
+        };
+
+        // Segments turning further are cut, so Slerp's shortest path is the fitted one.
+        static inline constexpr T MAX_SEGMENT_ANGLE = std::numbers::pi_v<T> / 2;
+
+        [[nodiscard]] auto Constraint(double time, const Quaternion<T>& q) const noexcept -> Ball
+        {
+            auto relative = _key.orientation.Conjugated() * q;
+
+            if (relative.W() < 0)
+            {
+                relative = -relative;
+            }
+
+            // Rotation vector over elapsed time; Log gives half the rotation angle.
+            const auto half = Log(relative);
+            const auto elapsed = static_cast<T>(time - _key.time);
+
+            return Ball{2 * half.X() / elapsed, 2 * half.Y() / elapsed, 2 * half.Z() / elapsed,
+                        _tolerance / elapsed};
+        }
+
+        // Shrinks _feasible to a ball inside its intersection with ball, false when disjoint.
+        auto Intersect(const Ball& ball, T elapsed) noexcept -> bool
+        {
+            const T dx = ball.x - _feasible.x;
+            const T dy = ball.y - _feasible.y;
+            const T dz = ball.z - _feasible.z;
+            const T distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+            if (distance > _feasible.radius + ball.radius)
+            {
+                return false;
+            }
+
+            Ball next = ball;
+
+            if (distance + _feasible.radius <= ball.radius)
+            {
+                next = _feasible;
+            }
+            else if (distance + ball.radius > _feasible.radius)
+            {
+                // Largest ball on the line of centers inside both.
+                const T offset = (distance - ball.radius + _feasible.radius) / 2 / distance;
+
+                next = Ball{_feasible.x + dx * offset, _feasible.y + dy * offset,
+                            _feasible.z + dz * offset,
+                            (_feasible.radius + ball.radius - distance) / 2};
+            }
+
+            const T speed = std::sqrt(next.x * next.x + next.y * next.y + next.z * next.z);
+
+            if (speed * elapsed > MAX_SEGMENT_ANGLE)
+            {
+                return false;
+            }
+
+            _feasible = next;
+
+            return true;
+        }
+
+        [[nodiscard]] auto SegmentEnd() const noexcept -> Keyframe<T>
+        {
+            const auto elapsed = static_cast<T>(_lastTime - _key.time);
+            const PureQuaternion<T> half{_feasible.x * elapsed / 2, _feasible.y * elapsed / 2,
+                                         _feasible.z * elapsed / 2};
+
+            return Keyframe<T>{_lastTime, (_key.orientation * Exp(half)).Normalized()};
+        }
+
+        T _tolerance;
+        Keyframe<T> _key{};
+        Ball _feasible{};
+        double _lastTime = 0;
+        bool _started = false;
+        // Samples were accepted after _key.
+        bool _pending = false;
+    };
+
+    namespace details
+    {
+        // Slerp parameters of a segment: start, unit axis and half angle of the whole turn.
+        template <std::floating_point T>
+        struct SlerpSegment
+        {
+            Quaternion<T> start;
+            T ax, ay, az, angle;
+            double begin, duration;
+        };
+
+        template <std::floating_point T>
+        [[nodiscard]] auto MakeSlerpSegment(const Keyframe<T>& from, const Keyframe<T>& to) noexcept
+            -> SlerpSegment<T>
+        {
+            const T sign = std::copysign(static_cast<T>(1), Dot(from.orientation, to.orientation));
+            const auto half = Log(from.orientation.Conjugated() * (to.orientation * sign));
+            const T angle = half.Norm();
+            const T inverse = angle > 0 ? 1 / angle : 0;
+
+            return SlerpSegment<T>{from.orientation, half.X() * inverse, half.Y() * inverse,
+                                   half.Z() * inverse, angle, from.time, to.time - from.time};
+        }
+
+        template <std::floating_point T, typename Out>
+        auto Reconstruct(std::span<const Keyframe<T>> keyframes, std::span<const double> times,
+                         Out out, std::size_t threads) -> void
+        {
+            assert(times.size() == BatchSize(out));
+
+            if (keyframes.empty())
+            {
+                if (!times.empty())
+                {
+                    throw std::invalid_argument("Cannot reconstruct from zero keyframes.");
+                }
+
+                return;
+            }
+
+            ForEachBlock(
+                times.size(), threads, BATCH_MIN_CHUNK,
+                [&](std::size_t offset, std::size_t count)
+                {
+                    // Pass 1 walks the sorted times through the segments, pass 2 evaluates
+                    // start * Exp(s * half) for the whole block without branches.
+                    StagedBlock<T> block{count};
+                    alignas(64) T ax[BATCH_BLOCK];
+                    alignas(64) T ay[BATCH_BLOCK];
+                    alignas(64) T az[BATCH_BLOCK];
+                    alignas(64) T turn[BATCH_BLOCK];
+
+                    const auto first = std::upper_bound(
+                        keyframes.begin(), keyframes.end(), times[offset],
+                        [](double time, const Keyframe<T>& key) { return time < key.time; });
+                    const std::size_t last = keyframes.size() - 1;
+                    // The segment ending at first, or the last one past the end.
+                    const auto after = std::min(
+                        static_cast<std::size_t>(first - keyframes.begin()), last);
+                    std::size_t index = after > 0 ? after - 1 : 0;
+
+                    auto segment = MakeSlerpSegment(keyframes[index],
+                                                    keyframes[std::min(index + 1, last)]);
+
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        const double time = times[offset + i];
+
+                        while (index + 1 < last && time >= keyframes[index + 1].time)
+                        {
+                            ++index;
+                            segment = MakeSlerpSegment(keyframes[index], keyframes[index + 1]);
+                        }
+
+                        const double s = segment.duration > 0
+                                             ? std::clamp((time - segment.begin) /
+                                                              segment.duration,
+                                                          0.0, 1.0)
+                                             : 0.0;
+
+                        block.x[i] = segment.start.X();
+                        block.y[i] = segment.start.Y();
+                        block.z[i] = segment.start.Z();
+                        block.w[i] = segment.start.W();
+                        ax[i] = segment.ax;
+                        ay[i] = segment.ay;
+                        az[i] = segment.az;
+                        turn[i] = static_cast<T>(s) * segment.angle /
+                                  (2 * std::numbers::pi_v<T>);
+                    }
+
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        T sine, cosine;
+                        SinCos2Pi(turn[i], sine, cosine);
+
+                        const T x1 = block.x[i], y1 = block.y[i], z1 = block.z[i];
+                        const T w1 = block.w[i];
+                        const T x2 = ax[i] * sine, y2 = ay[i] * sine, z2 = az[i] * sine;
+
+                        block.x[i] = w1 * x2 + x1 * cosine + y1 * z2 - z1 * y2;
+                        block.y[i] = w1 * y2 - x1 * z2 + y1 * cosine + z1 * x2;
+                        block.z[i] = w1 * z2 + x1 * y2 - y1 * x2 + z1 * cosine;
+                        block.w[i] = w1 * cosine - x1 * x2 - y1 * y2 - z1 * z2;
+                    }
+
+                    block.StoreTo(BatchSlice(out, offset, count));
+                });
+        }
+    } // namespace details
+
+    // out[i] = Slerp of the keyframes around times[i], clamped to the first and last keyframe.
+    // Keyframes and times sorted by time.
+    template <std::floating_point T>
+    auto Reconstruct(std::span<const Keyframe<T>> keyframes, std::span<const double> times,
+                     std::span<Quaternion<T>> out, std::size_t threads = 1) -> void
+    {
+        details::Reconstruct(keyframes, times, out, threads);
+    }
+
+    template <std::floating_point T>
+    auto Reconstruct(std::span<const Keyframe<T>> keyframes, std::span<const double> times,
+                     QuaternionSoASpan<T> out, std::size_t threads = 1) -> void
+    {
+        details::Reconstruct(keyframes, times, out, threads);
+    }
+
+    template <std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    auto Reconstruct(std::span<const Keyframe<T>> keyframes, std::span<const double> times,
+                     QuaternionStridedView<T, Order, Stride> out, std::size_t threads = 1) -> void
+    {
+        details::Reconstruct(keyframes, times, out, threads);
+    }
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_SIMPLIFIER(EXTERN, T)                                            \
+    EXTERN template class AttitudeSimplifier<T>;                                                   \
+    EXTERN template auto Reconstruct<T>(std::span<const Keyframe<T>>, std::span<const double>,     \
+                                        std::span<Quaternion<T>>, std::size_t) -> void;            \
+    EXTERN template auto Reconstruct<T>(std::span<const Keyframe<T>>, std::span<const double>,     \
+                                        QuaternionSoASpan<T>, std::size_t) -> void;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_SIMPLIFIER(extern, float)
+    QUATERNIONLIB_INSTANTIATE_SIMPLIFIER(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_ATTITUDESIMPLIFIER_HPP
@@ -1,6 +1,8 @@
 #ifndef QUATERNIONLIB_QUATERNION_HPP
 #define QUATERNIONLIB_QUATERNION_HPP
 
+#include "QuaternionConstexprMath.hpp"
+
 #include <cassert>
 #include <cmath>
 #include <concepts>
@@ -306,7 +308,7 @@ namespace quaternionlib
     template <details::Arithmetic T>
     constexpr auto Quaternion<T>::Norm() const noexcept -> T
     {
-        return std::sqrt((_x * _x) + (_y * _y) + (_z * _z) + (_w * _w));
+        return static_cast<T>(details::Sqrt((_x * _x) + (_y * _y) + (_z * _z) + (_w * _w)));
     }
 
     template <details::Arithmetic T>
@@ -337,7 +339,7 @@ namespace quaternionlib
     template <details::Arithmetic T>
     constexpr auto Quaternion<T>::IsNormalized() const noexcept -> bool
     {
-        return std::abs(Quaternion<T>::SquaredNorm() - static_cast<T>(1)) <= EPSILON<T>;
+        return details::Abs(Quaternion<T>::SquaredNorm() - static_cast<T>(1)) <= EPSILON<T>;
     }
 
     template <details::Arithmetic T>
@@ -450,8 +452,10 @@ namespace quaternionlib
     {
         using V = std::common_type_t<T, U>;
 
-        return std::abs(lhs.W() - rhs.W()) <= EPSILON<V> && std::abs(lhs.X() - rhs.X()) <= EPSILON<V> &&
-               std::abs(lhs.Y() - rhs.Y()) <= EPSILON<V> && std::abs(lhs.Z() - rhs.Z()) <= EPSILON<V>;
+        return details::Abs(lhs.W() - rhs.W()) <= EPSILON<V> &&
+               details::Abs(lhs.X() - rhs.X()) <= EPSILON<V> &&
+               details::Abs(lhs.Y() - rhs.Y()) <= EPSILON<V> &&
+               details::Abs(lhs.Z() - rhs.Z()) <= EPSILON<V>;
     }
 
     template <details::Arithmetic T, details::Arithmetic U>
@@ -583,4 +587,30 @@ namespace quaternionlib
 
 } // namespace quaternionlib
 
+// Explicit instantiations compiled once into the quaternion_lib_instantiations library. Targets
+// linking it get QUATERNIONLIB_EXTERN_TEMPLATES and stop instantiating them in every translation
+// unit; each header lists its own in a QUATERNIONLIB_INSTANTIATE_* macro.
+#define QUATERNIONLIB_INSTANTIATE_QUATERNION(EXTERN, T)                                            \
+    EXTERN template class Quaternion<T>;                                                           \
+    EXTERN template auto operator<< <T>(std::ostream&, const Quaternion<T>&) -> std::ostream&;     \
+    EXTERN template auto operator== <T, T>(const Quaternion<T>&, const Quaternion<T>&) noexcept    \
+        -> bool;                                                                                   \
+    EXTERN template auto operator+ <T, T>(const Quaternion<T>&, const Quaternion<T>&)              \
+        -> Quaternion<T>;                                                                          \
+    EXTERN template auto operator- <T, T>(const Quaternion<T>&, const Quaternion<T>&)              \
+        -> Quaternion<T>;                                                                          \
+    EXTERN template auto operator* <T, T>(const Quaternion<T>&, const Quaternion<T>&)              \
+        -> Quaternion<T>;                                                                          \
+    EXTERN template auto operator* <T, T>(const Quaternion<T>&, const T&) -> Quaternion<T>;        \
+    EXTERN template auto operator* <T, T>(const T&, const Quaternion<T>&) -> Quaternion<T>;        \
+    EXTERN template auto operator/ <T, T>(const Quaternion<T>&, const T&) -> Quaternion<T>;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_QUATERNION(extern, float)
+    QUATERNIONLIB_INSTANTIATE_QUATERNION(extern, double)
+} // namespace quaternionlib
+#endif
+
 #endif // QUATERNIONLIB_QUATERNION_HPP
@@ -0,0 +1,199 @@
+#ifndef QUATERNIONLIB_QUATERNIONACCUMULATOR_HPP
+#define QUATERNIONLIB_QUATERNIONACCUMULATOR_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionMath.hpp"
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+
+// Composition of long chains of rotations in double-length (double-double) arithmetic.
+namespace quaternionlib
+{
+    namespace details
+    {
+        // a + b = sum + error exactly (Knuth), for any magnitudes.
+        template <std::floating_point T>
+        constexpr auto TwoSum(T a, T b, T& sum, T& error) noexcept -> void
+        {
+            sum = a + b;
+
+            const T b2 = sum - a;
+
+            error = (a - (sum - b2)) + (b - b2);
+        }
+
+        // a * b = product + error exactly: one std::fma where the target has it, else Dekker's
+        // splitting, which -ffp-contract cannot break on targets without FMA.
+        template <std::floating_point T>
+        constexpr auto ExactProduct(T a, T b, T& product, T& error) noexcept -> void
+        {
+            if consteval
+            {
+                TwoProduct(a, b, product, error);
+            }
+            else
+            {
+                if constexpr (HAS_FAST_FMA<T>)
+                {
+                    product = a * b;
+                    error = std::fma(a, b, -product);
+                }
+                else
+                {
+                    TwoProduct(a, b, product, error);
+                }
+            }
+        }
+
+        // Sum of (aHigh + aLow)(bHigh + bLow) over four terms as high + low, with the high
+        // products exact and the low ones to working precision: error about eps^2 of the terms.
+        template <std::floating_point T>
+        constexpr auto CompensatedDot(const std::array<T, 4>& aHigh, const std::array<T, 4>& aLow,
+                                      const std::array<T, 4>& bHigh, const std::array<T, 4>& bLow,
+                                      T& high, T& low) noexcept -> void
+        {
+            T sum{}, error{};
+            ExactProduct(aHigh[0], bHigh[0], sum, error);
+
+            for (std::size_t i = 1; i < 4; ++i)
+            {
+                T product{}, productError{}, rounding{};
+                ExactProduct(aHigh[i], bHigh[i], product, productError);
+                TwoSum(sum, product, sum, rounding);
+
+                error += rounding + productError;
+            }
+
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                error += aHigh[i] * bLow[i] + aLow[i] * bHigh[i];
+            }
+
+            TwoSum(sum, error, high, low);
+        }
+    } // namespace details
+
+    // Running product of rotations, q = q * r per step, kept as an unevaluated sum of two
+    // quaternions so the chain loses about eps^2 per step instead of eps. Steps are taken as
+    // rotations: their deviation from unit norm, rounding in whoever computed them, is
+    // removed to second order, so the value stays unit to working precision over far more
+    // steps than operator*= and needs Renormalize only rarely, if at all.
+    template <std::floating_point T>
+    class RotationAccumulator final
+    {
+    public:
+        constexpr RotationAccumulator() noexcept = default;
+
+        constexpr explicit RotationAccumulator(const Quaternion<T>& initial) noexcept
+            : _value(initial)
+        {
+        }
+
+        constexpr auto operator*=(const Quaternion<T>& step) noexcept -> RotationAccumulator&
+        {
+            const std::array<T, 4> high{_value.X(), _value.Y(), _value.Z(), _value.W()};
+            const std::array<T, 4> low{_compensation.X(), _compensation.Y(), _compensation.Z(),
+                                       _compensation.W()};
+            const T x = step.X(), y = step.Y(), z = step.Z(), w = step.W();
+
+            // step * (1 - d / 2) with d = |step|^2 - 1 is unit up to O(d^2); the correction
+            // is the low part of the step.
+            const std::array<T, 4> components{x, y, z, w};
+            const std::array<T, 4> zero{};
+            T squaredNorm{}, squaredNormLow{};
+            details::CompensatedDot(components, zero, components, zero, squaredNorm,
+                                    squaredNormLow);
+
+            const T correction = -((squaredNorm - 1) + squaredNormLow) / 2;
+            const T cx = x * correction, cy = y * correction, cz = z * correction,
+                    cw = w * correction;
+
+            T outX{}, outY{}, outZ{}, outW{};
+            T lowX{}, lowY{}, lowZ{}, lowW{};
+
+            // Rows of the Hamilton product in the order of Quaternion::operator*=.
+            details::CompensatedDot(high, low, {w, z, -y, x}, {cw, cz, -cy, cx}, outX, lowX);
+            details::CompensatedDot(high, low, {-z, w, x, y}, {-cz, cw, cx, cy}, outY, lowY);
+            details::CompensatedDot(high, low, {y, -x, w, z}, {cy, -cx, cw, cz}, outZ, lowZ);
+            details::CompensatedDot(high, low, {-x, -y, -z, w}, {-cx, -cy, -cz, cw}, outW, lowW);
+
+            _value = Quaternion<T>{outX, outY, outZ, outW};
+            _compensation = Quaternion<T>{lowX, lowY, lowZ, lowW};
+
+            return *this;
+        }
+
+        // Scales the state onto the unit sphere in double-length arithmetic.
+        constexpr auto Renormalize() noexcept -> void
+        {
+            const std::array<T, 4> high{_value.X(), _value.Y(), _value.Z(), _value.W()};
+            const std::array<T, 4> low{_compensation.X(), _compensation.Y(), _compensation.Z(),
+                                       _compensation.W()};
+
+            T squaredNorm{}, squaredNormLow{};
+            details::CompensatedDot(high, low, high, low, squaredNorm, squaredNormLow);
+
+            if (!(squaredNorm > 0))
+            {
+                return;
+            }
+
+            // scale + scaleLow = 1 / sqrt(squaredNorm + squaredNormLow) by one Newton step
+            // from the working-precision root, with the residual computed exactly.
+            const T scale = 1 / details::Sqrt(squaredNorm);
+
+            T square{}, squareError{}, product{}, productError{};
+            details::ExactProduct(scale, scale, square, squareError);
+            details::ExactProduct(squaredNorm, square, product, productError);
+
+            const T residual = ((1 - product) - productError) -
+                               (squaredNorm * squareError + squaredNormLow * square);
+            const T scaleLow = scale * residual / 2;
+
+            std::array<T, 4> outHigh{}, outLow{};
+
+            for (std::size_t i = 0; i < 4; ++i)
+            {
+                T scaled{}, error{};
+                details::ExactProduct(high[i], scale, scaled, error);
+                details::TwoSum(scaled, error + high[i] * scaleLow + low[i] * scale, outHigh[i],
+                                outLow[i]);
+            }
+
+            _value = Quaternion<T>{outHigh[0], outHigh[1], outHigh[2], outHigh[3]};
+            _compensation = Quaternion<T>{outLow[0], outLow[1], outLow[2], outLow[3]};
+        }
+
+        // The accumulated rotation rounded to T.
+        [[nodiscard]] constexpr auto Value() const noexcept -> const Quaternion<T>&
+        {
+            return _value;
+        }
+
+        // What Value() lacks of the accumulated rotation, below half an ulp per component.
+        [[nodiscard]] constexpr auto Compensation() const noexcept -> const Quaternion<T>&
+        {
+            return _compensation;
+        }
+
+    private:
+        Quaternion<T> _value{0, 0, 0, 1};
+        Quaternion<T> _compensation{0, 0, 0, 0};
+    };
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_ACCUMULATOR(EXTERN, T)                                           \
+    EXTERN template class RotationAccumulator<T>;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_ACCUMULATOR(extern, float)
+    QUATERNIONLIB_INSTANTIATE_ACCUMULATOR(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONACCUMULATOR_HPP
@@ -0,0 +1,382 @@
+#ifndef QUATERNIONLIB_QUATERNIONCONSTEXPRMATH_HPP
+#define QUATERNIONLIB_QUATERNIONCONSTEXPRMATH_HPP
+
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+// Scalar functions usable in constant expressions. Each dispatches with if consteval: at run
+// time to <cmath>, during constant evaluation to the portable implementations below, so
+// rotation tables and constant frames can be computed at compile time.
+namespace quaternionlib::details
+{
+    // Intermediate precision of the compile-time transcendental functions.
+    using ConstexprWide = long double;
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto SignBit(T value) noexcept -> bool
+    {
+        if constexpr (std::numeric_limits<T>::is_iec559 && sizeof(T) == sizeof(std::uint32_t))
+        {
+            return (std::bit_cast<std::uint32_t>(value) >> 31) != 0;
+        }
+        else if constexpr (std::numeric_limits<T>::is_iec559 &&
+                           sizeof(T) == sizeof(std::uint64_t))
+        {
+            return (std::bit_cast<std::uint64_t>(value) >> 63) != 0;
+        }
+        else
+        {
+            // Padded formats cannot be bit_cast in constant evaluation; -0 reads as +0.
+            return value < 0;
+        }
+    }
+
+    // Exact product a * b = product + error by Dekker's splitting, which needs no FMA.
+    template <std::floating_point T>
+    constexpr auto TwoProduct(T a, T b, T& product, T& error) noexcept -> void
+    {
+        constexpr T factor =
+            static_cast<T>((std::uint64_t{1} << ((std::numeric_limits<T>::digits + 1) / 2)) + 1);
+
+        const auto split = [&](T value, T& high, T& low)
+        {
+            const T scaled = factor * value;
+
+            high = scaled - (scaled - value);
+            low = value - high;
+        };
+
+        T aHigh{}, aLow{}, bHigh{}, bLow{};
+
+        split(a, aHigh, aLow);
+        split(b, bHigh, bLow);
+
+        product = a * b;
+        error = ((aHigh * bHigh - product) + aHigh * bLow + aLow * bHigh) + aLow * bLow;
+    }
+
+    // Correctly rounded for float and double, so constant evaluation matches std::sqrt exactly;
+    // within an ulp for wider formats.
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto ConstexprSqrt(T value) noexcept -> T
+    {
+        if (!(value > 0) || value == std::numeric_limits<T>::infinity())
+        {
+            return value < 0 ? std::numeric_limits<T>::quiet_NaN() : value;
+        }
+
+        // value = x * scale^2 with x in [1, 4). Scaling by powers of two is exact, also for
+        // subnormal values.
+        constexpr T big = static_cast<T>(0x1p64);
+        constexpr T bigRoot = static_cast<T>(0x1p32);
+
+        T x = value;
+        T scale = 1;
+
+        while (x >= big)
+        {
+            x /= big;
+            scale *= bigRoot;
+        }
+
+        while (x < 1 / big)
+        {
+            x *= big;
+            scale /= bigRoot;
+        }
+
+        while (x >= 4)
+        {
+            x /= 4;
+            scale *= 2;
+        }
+
+        while (x < 1)
+        {
+            x *= 4;
+            scale /= 2;
+        }
+
+        // Newton from above; converges to within an ulp of sqrt(x) in [1, 2].
+        T root = (x + 1) / 2;
+
+        for (int i = 0; i < 8; ++i)
+        {
+            root = (root + x / root) / 2;
+        }
+
+        if constexpr (std::numeric_limits<T>::digits <= 53)
+        {
+            // With u = ulp(root), root rounds sqrt(x) correctly unless x - root^2 > root u
+            // (too low) or root^2 - x >= root u (too high). In units of u^2 both sides are
+            // integers below 2^56: x and square are within a factor of two, so x - square is
+            // exact, and error is the exact remainder of root^2.
+            constexpr T unit = std::numeric_limits<T>::epsilon();
+
+            for (int i = 0; i < 2; ++i)
+            {
+                T square{}, error{};
+                TwoProduct(root, root, square, error);
+
+                const auto residual = static_cast<std::int64_t>((x - square) / (unit * unit)) -
+                                      static_cast<std::int64_t>(error / (unit * unit));
+                const auto units = static_cast<std::int64_t>(root / unit);
+
+                if (residual > units)
+                {
+                    root += unit;
+                }
+                else if (-residual >= units && root > 1)
+                {
+                    root -= unit;
+                }
+            }
+        }
+
+        return root * scale;
+    }
+
+    // sin(r) and cos(r) for |r| <= pi / 4 by Taylor polynomials.
+    constexpr auto ConstexprSinCosReduced(ConstexprWide r, ConstexprWide& s,
+                                          ConstexprWide& c) noexcept -> void
+    {
+        const ConstexprWide r2 = r * r;
+
+        ConstexprWide sr = 1;
+        ConstexprWide cr = 1;
+
+        for (int k = 13; k >= 1; --k)
+        {
+            sr = 1 - r2 / static_cast<ConstexprWide>((2 * k) * (2 * k + 1)) * sr;
+            cr = 1 - r2 / static_cast<ConstexprWide>((2 * k - 1) * (2 * k)) * cr;
+        }
+
+        s = r * sr;
+        c = cr;
+    }
+
+    // Reduction by pi / 2 in three parts (Cody and Waite). The first two carry 24 bits each,
+    // so k times them is exact while |x| stays below about 2^20.
+    template <std::floating_point T>
+    constexpr auto ConstexprSinCos(T value, T& s, T& c) noexcept -> void
+    {
+        if (value != value || value == std::numeric_limits<T>::infinity() ||
+            value == -std::numeric_limits<T>::infinity())
+        {
+            s = c = std::numeric_limits<T>::quiet_NaN();
+            return;
+        }
+
+        constexpr ConstexprWide halfPi1 = 0x1.921fb6p+0L;
+        constexpr ConstexprWide halfPi2 = -0x1.777a5cp-25L;
+        constexpr ConstexprWide halfPi3 = -1.7151244994428828058165073723315624e-15L;
+
+        const auto x = static_cast<ConstexprWide>(value);
+        const ConstexprWide scaled = x * (2 / std::numbers::pi_v<ConstexprWide>);
+        const auto k = static_cast<std::int64_t>(scaled < 0 ? scaled - 0.5L : scaled + 0.5L);
+        const auto wideK = static_cast<ConstexprWide>(k);
+        const ConstexprWide r = ((x - wideK * halfPi1) - wideK * halfPi2) - wideK * halfPi3;
+
+        ConstexprWide sr{}, cr{};
+        ConstexprSinCosReduced(r, sr, cr);
+
+        switch (k & 3)
+        {
+        case 0:
+            s = static_cast<T>(sr);
+            c = static_cast<T>(cr);
+            break;
+        case 1:
+            s = static_cast<T>(cr);
+            c = static_cast<T>(-sr);
+            break;
+        case 2:
+            s = static_cast<T>(-sr);
+            c = static_cast<T>(-cr);
+            break;
+        default:
+            s = static_cast<T>(-cr);
+            c = static_cast<T>(sr);
+            break;
+        }
+
+        // sin(-0) is -0.
+        if (value == 0)
+        {
+            s = value;
+        }
+    }
+
+    // atan(t) for t >= 0: reflected into [0, 1], then halved twice with
+    // atan(t) = 2 atan(t / (1 + sqrt(1 + t^2))) so the series converges within 16 terms.
+    constexpr auto ConstexprAtan(ConstexprWide t) noexcept -> ConstexprWide
+    {
+        const bool reflect = t > 1;
+
+        if (reflect)
+        {
+            t = 1 / t;
+        }
+
+        for (int i = 0; i < 2; ++i)
+        {
+            t = t / (1 + ConstexprSqrt(1 + t * t));
+        }
+
+        const ConstexprWide t2 = t * t;
+        ConstexprWide series = 0;
+
+        for (int n = 16; n >= 0; --n)
+        {
+            series = 1 / static_cast<ConstexprWide>(2 * n + 1) - t2 * series;
+        }
+
+        const ConstexprWide angle = 4 * t * series;
+
+        return reflect ? std::numbers::pi_v<ConstexprWide> / 2 - angle : angle;
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto ConstexprAtan2(T y, T x) noexcept -> T
+    {
+        if (y != y || x != x)
+        {
+            return y + x;
+        }
+
+        constexpr ConstexprWide pi = std::numbers::pi_v<ConstexprWide>;
+        constexpr auto infinity = std::numeric_limits<ConstexprWide>::infinity();
+
+        const ConstexprWide ay = y < 0 ? -static_cast<ConstexprWide>(y) : y;
+        const ConstexprWide ax = x < 0 ? -static_cast<ConstexprWide>(x) : x;
+
+        ConstexprWide angle = 0;
+
+        if (ay == infinity)
+        {
+            angle = ax == infinity ? pi / 4 : pi / 2;
+        }
+        else if (ax == infinity || ay == 0)
+        {
+            angle = 0;
+        }
+        else
+        {
+            angle = ay <= ax ? ConstexprAtan(ay / ax) : pi / 2 - ConstexprAtan(ax / ay);
+        }
+
+        if (SignBit(x))
+        {
+            angle = pi - angle;
+        }
+
+        return static_cast<T>(SignBit(y) ? -angle : angle);
+    }
+
+    // For integral T, like std::sqrt, the result is double.
+    template <typename T>
+    requires std::is_arithmetic_v<T>
+    [[nodiscard]] constexpr auto Sqrt(T value) noexcept
+    {
+        if constexpr (std::integral<T>)
+        {
+            return Sqrt(static_cast<double>(value));
+        }
+        else
+        {
+            if consteval
+            {
+                return ConstexprSqrt(value);
+            }
+            else
+            {
+                return std::sqrt(value);
+            }
+        }
+    }
+
+    template <typename T>
+    requires std::is_arithmetic_v<T>
+    [[nodiscard]] constexpr auto Abs(T value) noexcept -> T
+    {
+        if constexpr (std::is_unsigned_v<T>)
+        {
+            return value;
+        }
+        else if consteval
+        {
+            return value < 0 ? static_cast<T>(-value) : value;
+        }
+        else
+        {
+            return std::abs(value);
+        }
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto CopySign(T magnitude, T sign) noexcept -> T
+    {
+        if consteval
+        {
+            const T absolute = magnitude < 0 ? -magnitude : magnitude;
+
+            return SignBit(sign) ? -absolute : absolute;
+        }
+        else
+        {
+            return std::copysign(magnitude, sign);
+        }
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto Sin(T value) noexcept -> T
+    {
+        if consteval
+        {
+            T s{}, c{};
+            ConstexprSinCos(value, s, c);
+
+            return s;
+        }
+        else
+        {
+            return std::sin(value);
+        }
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto Cos(T value) noexcept -> T
+    {
+        if consteval
+        {
+            T s{}, c{};
+            ConstexprSinCos(value, s, c);
+
+            return c;
+        }
+        else
+        {
+            return std::cos(value);
+        }
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto Atan2(T y, T x) noexcept -> T
+    {
+        if consteval
+        {
+            return ConstexprAtan2(y, x);
+        }
+        else
+        {
+            return std::atan2(y, x);
+        }
+    }
+} // namespace quaternionlib::details
+
+#endif // QUATERNIONLIB_QUATERNIONCONSTEXPRMATH_HPP
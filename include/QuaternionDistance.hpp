@@ -0,0 +1,398 @@
+#ifndef QUATERNIONLIB_QUATERNIONDISTANCE_HPP
+#define QUATERNIONLIB_QUATERNIONDISTANCE_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "QuaternionSparse.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+// Distances between rotations represented by unit quaternions, and the geodesics realizing them.
+// q and -q are the same rotation, so every metric here depends on |dot(a, b)| only.
+namespace quaternionlib
+{
+    enum class DistanceMetric
+    {
+        // Angle of the rotation taking a to b, in [0, pi].
+        Angle,
+        // 1 - |dot(a, b)|, in [0, 1]. Monotonic in Angle, so it gives the same ordering
+        // without a transcendental call.
+        InnerProduct
+    };
+
+    template <details::Arithmetic T>
+    [[nodiscard]] constexpr auto Dot(const Quaternion<T>& lhs, const Quaternion<T>& rhs) noexcept
+        -> T
+    {
+        return lhs.X() * rhs.X() + lhs.Y() * rhs.Y() + lhs.Z() * rhs.Z() + lhs.W() * rhs.W();
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto InnerProductDistance(const Quaternion<T>& lhs,
+                                                      const Quaternion<T>& rhs) noexcept -> T
+    {
+        const T dot = Dot(lhs, rhs);
+
+        return 1 - (dot < 0 ? -dot : dot);
+    }
+
+    // 4 * atan2(|a - b|, |a + b|) after flipping b into a's hemisphere. Unlike 2 * acos(|dot|)
+    // this stays accurate for nearly equal rotations.
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto AngularDistance(const Quaternion<T>& lhs,
+                                                 const Quaternion<T>& rhs) noexcept -> T
+    {
+        const T sign = details::CopySign(static_cast<T>(1), Dot(lhs, rhs));
+        const Quaternion<T> flipped = rhs * sign;
+
+        return 4 * details::Atan2((lhs - flipped).Norm(), (lhs + flipped).Norm());
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto Distance(const Quaternion<T>& lhs, const Quaternion<T>& rhs,
+                                          DistanceMetric metric) noexcept -> T
+    {
+        return metric == DistanceMetric::Angle ? AngularDistance(lhs, rhs)
+                                               : InnerProductDistance(lhs, rhs);
+    }
+
+    // Exponential of a pure quaternion, the unit quaternion rotating by 2 |v| about v.
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto Exp(const PureQuaternion<T>& v) noexcept -> Quaternion<T>
+    {
+        const T angle = v.Norm();
+        const T scale = angle > 0 ? details::Sin(angle) / angle : 1;
+
+        return Quaternion<T>{v.X() * scale, v.Y() * scale, v.Z() * scale, details::Cos(angle)};
+    }
+
+    // Logarithm of a unit quaternion, half the rotation angle times the rotation axis.
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto Log(const Quaternion<T>& q) noexcept -> PureQuaternion<T>
+    {
+        const T sine = PureQuaternion<T>{q.X(), q.Y(), q.Z()}.Norm();
+        const T scale = sine > 0 ? details::Atan2(sine, q.W()) / sine : 1;
+
+        return PureQuaternion<T>{q.X() * scale, q.Y() * scale, q.Z() * scale};
+    }
+
+    // Point at t in [0, 1] along the shortest rotation from lhs to rhs, unit quaternions.
+    // Accurate down to coincident inputs, where the sin(angle) form divides by zero.
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto Slerp(const Quaternion<T>& lhs, const Quaternion<T>& rhs,
+                                       T t) noexcept -> Quaternion<T>
+    {
+        const T sign = details::CopySign(static_cast<T>(1), Dot(lhs, rhs));
+        const auto half = Log(lhs.Conjugated() * (rhs * sign));
+
+        return lhs * Exp(PureQuaternion<T>{half.X() * t, half.Y() * t, half.Z() * t});
+    }
+
+    namespace details
+    {
+        // Rows per tile of a distance matrix. With the column block staged in L1 each row is a
+        // broadcast against it.
+        static inline constexpr std::size_t DISTANCE_ROW_TILE = 64;
+
+        // atan(x) for |x| <= 0.66, Cephes' rational approximation.
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto AtanSmall(T x) noexcept -> T
+        {
+            const T z = x * x;
+
+            const T p = (((static_cast<T>(-8.750608600031904122785e-1) * z +
+                           static_cast<T>(-1.615753718733365076637e1)) *
+                              z +
+                          static_cast<T>(-7.500855792314704667340e1)) *
+                             z +
+                         static_cast<T>(-1.228866684490136173410e2)) *
+                            z +
+                        static_cast<T>(-6.485021904942025371773e1);
+            const T q = ((((z + static_cast<T>(2.485846490142306297962e1)) * z +
+                           static_cast<T>(1.650270098316988542046e2)) *
+                              z +
+                          static_cast<T>(4.328810604912902668951e2)) *
+                             z +
+                         static_cast<T>(4.853903996359136964868e2)) *
+                            z +
+                        static_cast<T>(1.945506571482613964425e2);
+
+            return x + x * z * p / q;
+        }
+
+        // Distances from a to each quaternion of block, written to out.
+        template <std::floating_point T>
+        auto DistanceRow(const Quaternion<T>& a, const StagedBlock<T>& block, T* out,
+                         DistanceMetric metric) noexcept -> void
+        {
+            const T ax = a.X();
+            const T ay = a.Y();
+            const T az = a.Z();
+            const T aw = a.W();
+
+            if (metric == DistanceMetric::InnerProduct)
+            {
+                for (std::size_t j = 0; j < block.size; ++j)
+                {
+                    const T dot = ax * block.x[j] + ay * block.y[j] + az * block.z[j] +
+                                  aw * block.w[j];
+
+                    out[j] = 1 - std::abs(dot);
+                }
+
+                return;
+            }
+
+            for (std::size_t j = 0; j < block.size; ++j)
+            {
+                const T dot =
+                    ax * block.x[j] + ay * block.y[j] + az * block.z[j] + aw * block.w[j];
+                const T sign = std::copysign(static_cast<T>(1), dot);
+
+                const T dx = ax - sign * block.x[j];
+                const T dy = ay - sign * block.y[j];
+                const T dz = az - sign * block.z[j];
+                const T dw = aw - sign * block.w[j];
+                const T sx = ax + sign * block.x[j];
+                const T sy = ay + sign * block.y[j];
+                const T sz = az + sign * block.z[j];
+                const T sw = aw + sign * block.w[j];
+
+                const T difference = dx * dx + dy * dy + dz * dz + dw * dw;
+                const T sum = sx * sx + sy * sy + sz * sz + sw * sw;
+
+                // 4 * atan2(n, m) = 8 * atan(n / (m + sqrt(n^2 + m^2))), where the argument
+                // stays below tan(pi / 8) and needs no range reduction.
+                out[j] = 8 * AtanSmall(FastSqrt(difference) /
+                                       (FastSqrt(sum) + FastSqrt(difference + sum)));
+            }
+        }
+
+        template <std::floating_point T>
+        [[nodiscard]] auto LoadPoint(QuaternionSoASpan<const T> points, std::size_t i) noexcept
+            -> Quaternion<T>
+        {
+            return points.Load(i);
+        }
+
+        template <std::floating_point T>
+        [[nodiscard]] auto LoadPoint(std::span<const Quaternion<T>> points, std::size_t i) noexcept
+            -> Quaternion<T>
+        {
+            return points[i];
+        }
+
+        template <details::MaybeConstArithmetic T, ComponentOrder Order, std::size_t Stride>
+        [[nodiscard]] auto LoadPoint(QuaternionStridedView<T, Order, Stride> points,
+                                     std::size_t i) noexcept -> Quaternion<std::remove_const_t<T>>
+        {
+            return points.Load(i);
+        }
+
+        template <std::floating_point T, typename Points>
+        auto Distances(const Quaternion<T>& query, Points points, std::span<T> out,
+                       DistanceMetric metric, std::size_t threads) -> void
+        {
+            assert(out.size() == BatchSize(points));
+
+            ForEachBlock(BatchSize(points), threads, BATCH_MIN_CHUNK,
+                         [&](std::size_t offset, std::size_t count)
+                         {
+                             const StagedBlock<T> block{BatchSlice(points, offset, count)};
+                             DistanceRow(query, block, out.data() + offset, metric);
+                         });
+        }
+
+        template <std::floating_point T, typename Rows, typename Columns>
+        auto DistanceMatrix(Rows rows, Columns columns, std::span<T> out, DistanceMetric metric,
+                            std::size_t threads) -> void
+        {
+            const std::size_t rowCount = BatchSize(rows);
+            const std::size_t columnCount = BatchSize(columns);
+
+            assert(out.size() == rowCount * columnCount);
+
+            if (columnCount == 0)
+            {
+                return;
+            }
+
+            const std::size_t minRows = std::max<std::size_t>(1, BATCH_MIN_CHUNK / columnCount);
+
+            ParallelFor(rowCount, threads, minRows,
+                        [&](std::size_t begin, std::size_t end)
+                        {
+                            for (auto tile = begin; tile < end; tile += DISTANCE_ROW_TILE)
+                            {
+                                const auto tileEnd = std::min(end, tile + DISTANCE_ROW_TILE);
+
+                                for (std::size_t column = 0; column < columnCount;
+                                     column += BATCH_BLOCK)
+                                {
+                                    const auto count = std::min(BATCH_BLOCK, columnCount - column);
+                                    const StagedBlock<T> block{
+                                        BatchSlice(columns, column, count)};
+
+                                    for (auto row = tile; row < tileEnd; ++row)
+                                    {
+                                        DistanceRow(LoadPoint(rows, row), block,
+                                                    out.data() + row * columnCount + column,
+                                                    metric);
+                                    }
+                                }
+                            }
+                        });
+        }
+
+        template <std::floating_point T, typename Points>
+        [[nodiscard]] auto Nearest(const Quaternion<T>& query, Points points) -> std::size_t
+        {
+            if (BatchSize(points) == 0)
+            {
+                throw std::invalid_argument("Cannot find the nearest of zero quaternions.");
+            }
+
+            std::size_t best = 0;
+            T bestDistance = 2;
+            T distances[BATCH_BLOCK];
+
+            for (std::size_t offset = 0; offset < BatchSize(points); offset += BATCH_BLOCK)
+            {
+                const auto count = std::min(BATCH_BLOCK, BatchSize(points) - offset);
+                const StagedBlock<T> block{BatchSlice(points, offset, count)};
+
+                DistanceRow(query, block, distances, DistanceMetric::InnerProduct);
+
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    if (distances[j] < bestDistance)
+                    {
+                        best = offset + j;
+                        bestDistance = distances[j];
+                    }
+                }
+            }
+
+            return best;
+        }
+    } // namespace details
+
+    // out[i] = distance(query, points[i]).
+    template <std::floating_point T>
+    auto Distances(const Quaternion<T>& query, QuaternionSoASpan<const T> points,
+                   std::span<T> out, DistanceMetric metric = DistanceMetric::Angle,
+                   std::size_t threads = 1) -> void
+    {
+        details::Distances(query, points, out, metric, threads);
+    }
+
+    template <std::floating_point T>
+    auto Distances(const Quaternion<T>& query, std::span<const Quaternion<T>> points,
+                   std::span<T> out, DistanceMetric metric = DistanceMetric::Angle,
+                   std::size_t threads = 1) -> void
+    {
+        details::Distances(query, points, out, metric, threads);
+    }
+
+    template <details::MaybeConstArithmetic U, ComponentOrder Order, std::size_t Stride>
+    requires std::floating_point<std::remove_const_t<U>>
+    auto Distances(const Quaternion<std::remove_const_t<U>>& query,
+                   QuaternionStridedView<U, Order, Stride> points,
+                   std::span<std::remove_const_t<U>> out,
+                   DistanceMetric metric = DistanceMetric::Angle, std::size_t threads = 1) -> void
+    {
+        details::Distances(query, points, out, metric, threads);
+    }
+
+    // Row-major rows.Size() x columns.Size() matrix, out[i * columns.Size() + j] =
+    // distance(rows[i], columns[j]). Pass the same set twice for all pairs.
+    template <std::floating_point T>
+    auto DistanceMatrix(QuaternionSoASpan<const T> rows, QuaternionSoASpan<const T> columns,
+                        std::span<T> out, DistanceMetric metric = DistanceMetric::Angle,
+                        std::size_t threads = 1) -> void
+    {
+        details::DistanceMatrix(rows, columns, out, metric, threads);
+    }
+
+    template <std::floating_point T>
+    auto DistanceMatrix(std::span<const Quaternion<T>> rows,
+                        std::span<const Quaternion<T>> columns, std::span<T> out,
+                        DistanceMetric metric = DistanceMetric::Angle, std::size_t threads = 1)
+        -> void
+    {
+        details::DistanceMatrix(rows, columns, out, metric, threads);
+    }
+
+    template <details::MaybeConstArithmetic U, ComponentOrder RowOrder, std::size_t RowStride,
+              ComponentOrder ColumnOrder, std::size_t ColumnStride>
+    requires std::floating_point<std::remove_const_t<U>>
+    auto DistanceMatrix(QuaternionStridedView<U, RowOrder, RowStride> rows,
+                        QuaternionStridedView<U, ColumnOrder, ColumnStride> columns,
+                        std::span<std::remove_const_t<U>> out,
+                        DistanceMetric metric = DistanceMetric::Angle, std::size_t threads = 1)
+        -> void
+    {
+        details::DistanceMatrix(rows, columns, out, metric, threads);
+    }
+
+    // Index of the rotation in points closest to query. Compares inner products only.
+    template <std::floating_point T>
+    [[nodiscard]] auto Nearest(const Quaternion<T>& query, QuaternionSoASpan<const T> points)
+        -> std::size_t
+    {
+        return details::Nearest(query, points);
+    }
+
+    template <std::floating_point T>
+    [[nodiscard]] auto Nearest(const Quaternion<T>& query, std::span<const Quaternion<T>> points)
+        -> std::size_t
+    {
+        return details::Nearest(query, points);
+    }
+
+    template <details::MaybeConstArithmetic U, ComponentOrder Order, std::size_t Stride>
+    requires std::floating_point<std::remove_const_t<U>>
+    [[nodiscard]] auto Nearest(const Quaternion<std::remove_const_t<U>>& query,
+                               QuaternionStridedView<U, Order, Stride> points) -> std::size_t
+    {
+        return details::Nearest(query, points);
+    }
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_DISTANCE(EXTERN, T)                                              \
+    EXTERN template auto AngularDistance<T>(const Quaternion<T>&, const Quaternion<T>&) noexcept   \
+        -> T;                                                                                      \
+    EXTERN template auto Distance<T>(const Quaternion<T>&, const Quaternion<T>&,                   \
+                                     DistanceMetric) noexcept -> T;                                \
+    EXTERN template auto Distances<T>(const Quaternion<T>&, QuaternionSoASpan<const T>,            \
+                                      std::span<T>, DistanceMetric, std::size_t) -> void;          \
+    EXTERN template auto Distances<T>(const Quaternion<T>&, std::span<const Quaternion<T>>,        \
+                                      std::span<T>, DistanceMetric, std::size_t) -> void;          \
+    EXTERN template auto DistanceMatrix<T>(QuaternionSoASpan<const T>, QuaternionSoASpan<const T>, \
+                                           std::span<T>, DistanceMetric, std::size_t) -> void;     \
+    EXTERN template auto DistanceMatrix<T>(std::span<const Quaternion<T>>,                         \
+                                           std::span<const Quaternion<T>>, std::span<T>,           \
+                                           DistanceMetric, std::size_t) -> void;                   \
+    EXTERN template auto Nearest<T>(const Quaternion<T>&, QuaternionSoASpan<const T>)              \
+        -> std::size_t;                                                                            \
+    EXTERN template auto Nearest<T>(const Quaternion<T>&, std::span<const Quaternion<T>>)          \
+        -> std::size_t;                                                                            \
+    EXTERN template auto Exp<T>(const PureQuaternion<T>&) noexcept -> Quaternion<T>;               \
+    EXTERN template auto Log<T>(const Quaternion<T>&) noexcept -> PureQuaternion<T>;               \
+    EXTERN template auto Slerp<T>(const Quaternion<T>&, const Quaternion<T>&, T) noexcept          \
+        -> Quaternion<T>;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_DISTANCE(extern, float)
+    QUATERNIONLIB_INSTANTIATE_DISTANCE(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONDISTANCE_HPP
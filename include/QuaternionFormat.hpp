@@ -0,0 +1,339 @@
+#ifndef QUATERNIONLIB_QUATERNIONFORMAT_HPP
+#define QUATERNIONLIB_QUATERNIONFORMAT_HPP
+
+#include "Quaternion.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <algorithm>
+#include <format>
+#endif
+
+namespace quaternionlib
+{
+    enum class TextLayout
+    {
+        Quaternion, // Quaternion(x, y, z, w), same as operator<<
+        Csv,        // x,y,z,w
+        Json        // {"x":x,"y":y,"z":z,"w":w}
+    };
+
+    struct TextFormat
+    {
+        TextLayout layout = TextLayout::Csv;
+        std::chars_format format = std::chars_format::general;
+        int precision = -1; // < 0 means shortest round-trip representation
+    };
+
+    namespace details
+    {
+        struct LayoutTokens
+        {
+            std::string_view open;
+            std::string_view separators[3];
+            std::string_view close;
+        };
+
+        [[nodiscard]] constexpr auto TokensOf(TextLayout layout) noexcept -> LayoutTokens
+        {
+            switch (layout)
+            {
+            case TextLayout::Quaternion:
+                return {"Quaternion(", {", ", ", ", ", "}, ")"};
+            case TextLayout::Json:
+                return {"{\"x\":", {",\"y\":", ",\"z\":", ",\"w\":"}, "}"};
+            case TextLayout::Csv:
+            default:
+                return {"", {",", ",", ","}, ""};
+            }
+        }
+
+        [[nodiscard]] constexpr auto TokensSize(TextLayout layout) noexcept -> std::size_t
+        {
+            const auto tokens = TokensOf(layout);
+
+            return tokens.open.size() + tokens.separators[0].size() + tokens.separators[1].size() +
+                   tokens.separators[2].size() + tokens.close.size();
+        }
+
+        [[nodiscard]] inline auto Append(char* first, char* last, std::string_view text) noexcept
+            -> std::to_chars_result
+        {
+            if (static_cast<std::size_t>(last - first) < text.size())
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            if (!text.empty())
+            {
+                std::memcpy(first, text.data(), text.size());
+            }
+
+            return {first + text.size(), std::errc{}};
+        }
+
+        template <Arithmetic T>
+        [[nodiscard]] auto ComponentToChars(char* first, char* last, const T& value,
+                                            const TextFormat& format) noexcept
+            -> std::to_chars_result
+        {
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                if (format.precision >= 0)
+                {
+                    return std::to_chars(first, last, value, format.format, format.precision);
+                }
+
+                if (format.format == std::chars_format::general)
+                {
+                    return std::to_chars(first, last, value);
+                }
+
+                return std::to_chars(first, last, value, format.format);
+            }
+            else
+            {
+                return std::to_chars(first, last, value);
+            }
+        }
+
+        [[nodiscard]] constexpr auto DecimalDigits(int value) noexcept -> std::size_t
+        {
+            std::size_t digits = 1;
+
+            while (value >= 10)
+            {
+                value /= 10;
+                ++digits;
+            }
+
+            return digits;
+        }
+
+        template <Arithmetic T>
+        [[nodiscard]] constexpr auto MaxComponentSize(const TextFormat& format) noexcept
+            -> std::size_t
+        {
+            using Limits = std::numeric_limits<T>;
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                const auto mantissa = format.precision >= 0
+                                          ? static_cast<std::size_t>(format.precision)
+                                          : static_cast<std::size_t>(Limits::max_digits10);
+                // 'e' or 'p' and the sign; hex exponents are binary, down to p-1074 for double
+                const auto exponent =
+                    2 + (format.format == std::chars_format::hex
+                             ? DecimalDigits(-Limits::min_exponent + Limits::digits)
+                             : DecimalDigits(-Limits::min_exponent10 + Limits::digits10));
+
+                // sign, leading digit and decimal point
+                auto size = mantissa + exponent + 3;
+
+                if (format.format == std::chars_format::fixed)
+                {
+                    size += static_cast<std::size_t>(Limits::max_exponent10);
+
+                    if (format.precision < 0)
+                    {
+                        // shortest fixed output may need every digit of the smallest subnormal
+                        size += static_cast<std::size_t>(-Limits::min_exponent10 + Limits::digits10);
+                    }
+                }
+
+                return size;
+            }
+            else
+            {
+                return static_cast<std::size_t>(Limits::digits10) + 2;
+            }
+        }
+    } // namespace details
+
+    template <details::Arithmetic T>
+    [[nodiscard]] constexpr auto MaxTextSize(const TextFormat& format = {}) noexcept -> std::size_t
+    {
+        return details::TokensSize(format.layout) + 4 * details::MaxComponentSize<T>(format);
+    }
+
+    template <details::Arithmetic T>
+    [[nodiscard]] constexpr auto MaxTextSize(std::size_t count, const TextFormat& format = {}) noexcept
+        -> std::size_t
+    {
+        // every record is followed by a separator, JSON arrays add the enclosing brackets
+        const std::size_t brackets = format.layout == TextLayout::Json ? 2 : 0;
+
+        return count * (MaxTextSize<T>(format) + 1) + brackets;
+    }
+
+    template <details::Arithmetic T>
+    [[nodiscard]] auto ToChars(char* first, char* last, const Quaternion<T>& q,
+                               const TextFormat& format = {}) noexcept -> std::to_chars_result
+    {
+        const auto tokens = details::TokensOf(format.layout);
+        const T components[4] = {q.X(), q.Y(), q.Z(), q.W()};
+
+        auto result = details::Append(first, last, tokens.open);
+
+        for (std::size_t i = 0; i < 4 && result.ec == std::errc{}; ++i)
+        {
+            result = details::ComponentToChars(result.ptr, last, components[i], format);
+
+            if (result.ec == std::errc{})
+            {
+                result = details::Append(result.ptr, last,
+                                         i < 3 ? tokens.separators[i] : tokens.close);
+            }
+        }
+
+        if (result.ec != std::errc{})
+        {
+            return {last, result.ec};
+        }
+
+        return result;
+    }
+
+    template <details::Arithmetic T>
+    [[nodiscard]] auto WriteText(std::span<const Quaternion<T>> quaternions, std::span<char> buffer,
+                                 const TextFormat& format = {}) noexcept -> std::to_chars_result
+    {
+        char* const last = buffer.data() + buffer.size();
+        const bool json = format.layout == TextLayout::Json;
+        const std::string_view separator = json ? "," : "\n";
+
+        auto result = details::Append(buffer.data(), last, json ? "[" : "");
+
+        for (std::size_t i = 0; i < quaternions.size() && result.ec == std::errc{}; ++i)
+        {
+            result = ToChars(result.ptr, last, quaternions[i], format);
+
+            if (result.ec == std::errc{} && (!json || i + 1 < quaternions.size()))
+            {
+                result = details::Append(result.ptr, last, separator);
+            }
+        }
+
+        if (result.ec == std::errc{} && json)
+        {
+            result = details::Append(result.ptr, last, "]");
+        }
+
+        if (result.ec != std::errc{})
+        {
+            return {last, result.ec};
+        }
+
+        return result;
+    }
+
+    template <details::Arithmetic T>
+    [[nodiscard]] auto WriteCsv(std::span<const Quaternion<T>> quaternions,
+                                std::span<char> buffer, int precision = -1) noexcept
+        -> std::to_chars_result
+    {
+        return WriteText(quaternions, buffer,
+                         TextFormat{TextLayout::Csv, std::chars_format::general, precision});
+    }
+
+    template <details::Arithmetic T>
+    [[nodiscard]] auto WriteJson(std::span<const Quaternion<T>> quaternions,
+                                 std::span<char> buffer, int precision = -1) noexcept
+        -> std::to_chars_result
+    {
+        return WriteText(quaternions, buffer,
+                         TextFormat{TextLayout::Json, std::chars_format::general, precision});
+    }
+} // namespace quaternionlib
+
+#if defined(__cpp_lib_format)
+
+// Format spec: [layout][component-spec], where layout is 'q' (default), 'c' (CSV) or 'j' (JSON)
+// and component-spec is forwarded to std::formatter<T>, e.g. "{:c.3f}".
+template <quaternionlib::details::Arithmetic T>
+struct std::formatter<quaternionlib::Quaternion<T>, char>
+{
+    constexpr auto parse(std::format_parse_context& ctx) -> std::format_parse_context::iterator
+    {
+        auto it = ctx.begin();
+
+        if (it != ctx.end())
+        {
+            switch (*it)
+            {
+            case 'q':
+                _layout = quaternionlib::TextLayout::Quaternion;
+                ++it;
+                break;
+            case 'c':
+                _layout = quaternionlib::TextLayout::Csv;
+                ++it;
+                break;
+            case 'j':
+                _layout = quaternionlib::TextLayout::Json;
+                ++it;
+                break;
+            default:
+                break;
+            }
+        }
+
+        ctx.advance_to(it);
+
+        return _component.parse(ctx);
+    }
+
+    template <typename FormatContext>
+    auto format(const quaternionlib::Quaternion<T>& q, FormatContext& ctx) const
+        -> typename FormatContext::iterator
+    {
+        const auto tokens = quaternionlib::details::TokensOf(_layout);
+        const T components[4] = {q.X(), q.Y(), q.Z(), q.W()};
+
+        auto out = std::ranges::copy(tokens.open, ctx.out()).out;
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            ctx.advance_to(out);
+            out = _component.format(components[i], ctx);
+            out = std::ranges::copy(i < 3 ? tokens.separators[i] : tokens.close, out).out;
+        }
+
+        return out;
+    }
+
+private:
+    quaternionlib::TextLayout _layout = quaternionlib::TextLayout::Quaternion;
+    std::formatter<T, char> _component;
+};
+
+#endif // __cpp_lib_format
+
+#define QUATERNIONLIB_INSTANTIATE_FORMAT(EXTERN, T)                                                \
+    EXTERN template auto ToChars<T>(char*, char*, const Quaternion<T>&,                            \
+                                    const TextFormat&) noexcept -> std::to_chars_result;           \
+    EXTERN template auto WriteText<T>(std::span<const Quaternion<T>>, std::span<char>,             \
+                                      const TextFormat&) noexcept -> std::to_chars_result;         \
+    EXTERN template auto WriteCsv<T>(std::span<const Quaternion<T>>, std::span<char>,              \
+                                     int) noexcept -> std::to_chars_result;                        \
+    EXTERN template auto WriteJson<T>(std::span<const Quaternion<T>>, std::span<char>,             \
+                                      int) noexcept -> std::to_chars_result;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_FORMAT(extern, float)
+    QUATERNIONLIB_INSTANTIATE_FORMAT(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONFORMAT_HPP
@@ -0,0 +1,225 @@
+#ifndef QUATERNIONLIB_QUATERNIONMATH_HPP
+#define QUATERNIONLIB_QUATERNIONMATH_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+// Core arithmetic with an explicit floating-point evaluation policy, selected per call site so
+// each subsystem can trade reproducibility for speed. The member operators of Quaternion leave
+// both choices to the compiler flags.
+namespace quaternionlib
+{
+    enum class MathPolicy
+    {
+        // Bit-identical on every IEEE 754 target without excess precision, whatever -ffp-contract
+        // or -march say: every product is rounded before it is summed, sums run in a fixed order
+        // and sqrt is the correctly rounded std::sqrt. Matches constant evaluation exactly.
+        Deterministic,
+        // Products fused into std::fma where the target has hardware FMA, sums reassociated into
+        // independent pairs and divisions replaced by a refined reciprocal square root. Within a
+        // few ulp of Deterministic, and free to differ between targets.
+        Fast
+    };
+
+    namespace details
+    {
+        template <typename T>
+        static inline constexpr bool HAS_FAST_FMA =
+#if defined(FP_FAST_FMAF)
+            std::is_same_v<T, float> ||
+#endif
+#if defined(FP_FAST_FMA)
+            std::is_same_v<T, double> ||
+#endif
+#if defined(FP_FAST_FMAL)
+            std::is_same_v<T, long double> ||
+#endif
+            false;
+
+        // Opaque to the optimizer, so value is rounded to T here and cannot be contracted into
+        // a neighbouring addition.
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto Rounded(T value) noexcept -> T
+        {
+            static_assert(FLT_EVAL_METHOD == 0 || sizeof(T) == 0,
+                          "Deterministic math requires a target without excess precision.");
+
+            if !consteval
+            {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+                __asm__("" : "+xm"(value));
+#elif defined(__GNUC__) && defined(__aarch64__)
+                __asm__("" : "+wm"(value));
+#elif defined(__GNUC__)
+                __asm__("" : "+m"(value));
+#endif
+            }
+
+            return value;
+        }
+
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto FusedMultiplyAdd(T a, T b, T c) noexcept -> T
+        {
+            if constexpr (HAS_FAST_FMA<T>)
+            {
+                return std::fma(a, b, c);
+            }
+            else
+            {
+                return a * b + c;
+            }
+        }
+
+        template <MathPolicy Policy, std::floating_point T>
+        [[nodiscard]] constexpr auto SquaredNorm(T x, T y, T z, T w) noexcept -> T
+        {
+            if constexpr (Policy == MathPolicy::Deterministic)
+            {
+                return ((Rounded(x * x) + Rounded(y * y)) + Rounded(z * z)) + Rounded(w * w);
+            }
+            else
+            {
+                return FusedMultiplyAdd(x, x, y * y) + FusedMultiplyAdd(z, z, w * w);
+            }
+        }
+
+        // Hamilton product (x1, y1, z1, w1)(x2, y2, z2, w2) in the order of Quaternion::operator*=.
+        template <MathPolicy Policy, std::floating_point T>
+        constexpr auto HamiltonProduct(T x1, T y1, T z1, T w1, T x2, T y2, T z2, T w2, T& x, T& y,
+                                       T& z, T& w) noexcept -> void
+        {
+            if constexpr (Policy == MathPolicy::Deterministic)
+            {
+                x = ((Rounded(w1 * x2) + Rounded(x1 * w2)) + Rounded(y1 * z2)) - Rounded(z1 * y2);
+                y = ((Rounded(w1 * y2) - Rounded(x1 * z2)) + Rounded(y1 * w2)) + Rounded(z1 * x2);
+                z = ((Rounded(w1 * z2) + Rounded(x1 * y2)) - Rounded(y1 * x2)) + Rounded(z1 * w2);
+                w = ((Rounded(w1 * w2) - Rounded(x1 * x2)) - Rounded(y1 * y2)) - Rounded(z1 * z2);
+            }
+            else
+            {
+                x = FusedMultiplyAdd(w1, x2, x1 * w2) + FusedMultiplyAdd(y1, z2, -(z1 * y2));
+                y = FusedMultiplyAdd(w1, y2, -(x1 * z2)) + FusedMultiplyAdd(y1, w2, z1 * x2);
+                z = FusedMultiplyAdd(w1, z2, x1 * y2) + FusedMultiplyAdd(z1, w2, -(y1 * x2));
+                w = FusedMultiplyAdd(w1, w2, -(x1 * x2)) - FusedMultiplyAdd(y1, y2, z1 * z2);
+            }
+        }
+
+        // Scale making (x, y, z, w) unit: 1 / sqrt for Fast, the divisor sqrt for Deterministic.
+        template <MathPolicy Policy, std::floating_point T>
+        [[nodiscard]] constexpr auto NormalizationScale(T squaredNorm) noexcept -> T
+        {
+            if constexpr (Policy == MathPolicy::Deterministic)
+            {
+                return details::Sqrt(squaredNorm);
+            }
+            else
+            {
+                const T inverse = FastInverseSqrt(squaredNorm);
+
+                return inverse * (static_cast<T>(1.5) -
+                                  static_cast<T>(0.5) * squaredNorm * inverse * inverse);
+            }
+        }
+
+        template <MathPolicy Policy, std::floating_point T>
+        constexpr auto Normalize(T& x, T& y, T& z, T& w) noexcept -> void
+        {
+            const T scale = NormalizationScale<Policy>(SquaredNorm<Policy>(x, y, z, w));
+
+            if constexpr (Policy == MathPolicy::Deterministic)
+            {
+                x /= scale;
+                y /= scale;
+                z /= scale;
+                w /= scale;
+            }
+            else
+            {
+                x *= scale;
+                y *= scale;
+                z *= scale;
+                w *= scale;
+            }
+        }
+    } // namespace details
+
+    template <MathPolicy Policy, std::floating_point T>
+    [[nodiscard]] constexpr auto SquaredNorm(const Quaternion<T>& q) noexcept -> T
+    {
+        return details::SquaredNorm<Policy>(q.X(), q.Y(), q.Z(), q.W());
+    }
+
+    template <MathPolicy Policy, std::floating_point T>
+    [[nodiscard]] constexpr auto Norm(const Quaternion<T>& q) noexcept -> T
+    {
+        return details::Sqrt(SquaredNorm<Policy>(q));
+    }
+
+    template <MathPolicy Policy, std::floating_point T>
+    [[nodiscard]] constexpr auto Normalized(const Quaternion<T>& q) noexcept -> Quaternion<T>
+    {
+        T x = q.X();
+        T y = q.Y();
+        T z = q.Z();
+        T w = q.W();
+
+        details::Normalize<Policy>(x, y, z, w);
+
+        return Quaternion<T>{x, y, z, w};
+    }
+
+    template <MathPolicy Policy, std::floating_point T>
+    [[nodiscard]] constexpr auto Multiply(const Quaternion<T>& lhs,
+                                          const Quaternion<T>& rhs) noexcept -> Quaternion<T>
+    {
+        T x{}, y{}, z{}, w{};
+
+        details::HamiltonProduct<Policy>(lhs.X(), lhs.Y(), lhs.Z(), lhs.W(), rhs.X(), rhs.Y(),
+                                         rhs.Z(), rhs.W(), x, y, z, w);
+
+        return Quaternion<T>{x, y, z, w};
+    }
+
+    // out[i] = lhs[i] * rhs[i]. out may alias either operand.
+    template <MathPolicy Policy, std::floating_point T>
+    auto Multiply(QuaternionSoASpan<const T> lhs, QuaternionSoASpan<const T> rhs,
+                  QuaternionSoASpan<T> out, std::size_t threads = 1) -> void
+    {
+        assert(lhs.Size() == out.Size() && rhs.Size() == out.Size());
+
+        details::ForEachBlock(out.Size(), threads, details::BATCH_MIN_CHUNK,
+                              [&](std::size_t offset, std::size_t count)
+                              {
+                                  for (std::size_t i = offset; i < offset + count; ++i)
+                                  {
+                                      details::HamiltonProduct<Policy>(
+                                          lhs.x[i], lhs.y[i], lhs.z[i], lhs.w[i], rhs.x[i],
+                                          rhs.y[i], rhs.z[i], rhs.w[i], out.x[i], out.y[i],
+                                          out.z[i], out.w[i]);
+                                  }
+                              });
+    }
+
+    template <MathPolicy Policy, std::floating_point T>
+    auto Normalize(QuaternionSoASpan<T> q, std::size_t threads = 1) -> void
+    {
+        details::ForEachBlock(q.Size(), threads, details::BATCH_MIN_CHUNK,
+                              [&](std::size_t offset, std::size_t count)
+                              {
+                                  for (std::size_t i = offset; i < offset + count; ++i)
+                                  {
+                                      details::Normalize<Policy>(q.x[i], q.y[i], q.z[i], q.w[i]);
+                                  }
+                              });
+    }
+} // namespace quaternionlib
+
+#endif // QUATERNIONLIB_QUATERNIONMATH_HPP
@@ -0,0 +1,80 @@
+#ifndef QUATERNIONLIB_QUATERNIONPARALLEL_HPP
+#define QUATERNIONLIB_QUATERNIONPARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace quaternionlib::details
+{
+    // 0 requests one thread per hardware core; the result never exceeds the number of work items.
+    [[nodiscard]] inline auto ThreadCount(std::size_t requested, std::size_t items) noexcept
+        -> std::size_t
+    {
+        if (requested == 0)
+        {
+            requested = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        }
+
+        return std::max<std::size_t>(std::min(requested, items), 1);
+    }
+
+    // Splits [0, count) into contiguous ranges of at least minChunk items and calls
+    // f(begin, end) for each of them, running every range but the first on its own thread.
+    template <typename F>
+    auto ParallelFor(std::size_t count, std::size_t threads, std::size_t minChunk, F&& f) -> void
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        minChunk = std::max<std::size_t>(minChunk, 1);
+
+        const auto chunks = ThreadCount(threads, (count + minChunk - 1) / minChunk);
+
+        if (chunks == 1)
+        {
+            f(std::size_t{0}, count);
+            return;
+        }
+
+        std::vector<std::exception_ptr> errors(chunks);
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunks - 1);
+
+            const auto run = [&](std::size_t chunk)
+            {
+                try
+                {
+                    f(chunk * count / chunks, (chunk + 1) * count / chunks);
+                }
+                catch (...)
+                {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+
+            for (std::size_t chunk = 1; chunk < chunks; ++chunk)
+            {
+                workers.emplace_back(run, chunk);
+            }
+
+            run(0);
+        }
+
+        for (const auto& error : errors)
+        {
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+} // namespace quaternionlib::details
+
+#endif // QUATERNIONLIB_QUATERNIONPARALLEL_HPP
@@ -0,0 +1,400 @@
+#ifndef QUATERNIONLIB_QUATERNIONPARSE_HPP
+#define QUATERNIONLIB_QUATERNIONPARSE_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionParallel.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define QUATERNIONLIB_HAS_MMAP 1
+#endif
+
+namespace quaternionlib
+{
+    namespace details
+    {
+        [[nodiscard]] constexpr auto IsBlank(char c) noexcept -> bool
+        {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        [[nodiscard]] constexpr auto SkipBlanks(const char* first, const char* last) noexcept
+            -> const char*
+        {
+            while (first != last && IsBlank(*first))
+            {
+                ++first;
+            }
+
+            return first;
+        }
+
+        [[nodiscard]] constexpr auto IsBlankLine(std::string_view line) noexcept -> bool
+        {
+            return SkipBlanks(line.data(), line.data() + line.size()) == line.data() + line.size();
+        }
+
+        [[nodiscard]] inline auto MalformedRecord(std::size_t line) -> std::invalid_argument
+        {
+            return std::invalid_argument("Malformed quaternion record at line " +
+                                         std::to_string(line) + ".");
+        }
+    } // namespace details
+
+    // Parses one record, either "Quaternion(x, y, z, w)" as written by operator<< or "x,y,z,w".
+    // Blanks around components are skipped. On failure ptr points at the offending character.
+    template <details::Arithmetic T>
+    [[nodiscard]] auto FromChars(const char* first, const char* last, Quaternion<T>& q) noexcept
+        -> std::from_chars_result
+    {
+        constexpr std::string_view prefix = "Quaternion(";
+
+        auto it = details::SkipBlanks(first, last);
+        const bool wrapped = static_cast<std::size_t>(last - it) >= prefix.size() &&
+                             std::string_view(it, prefix.size()) == prefix;
+
+        if (wrapped)
+        {
+            it += prefix.size();
+        }
+
+        T components[4];
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            it = details::SkipBlanks(it, last);
+
+            const auto result = std::from_chars(it, last, components[i]);
+
+            if (result.ec != std::errc{})
+            {
+                return result;
+            }
+
+            it = details::SkipBlanks(result.ptr, last);
+
+            if (i < 3)
+            {
+                if (it == last || *it != ',')
+                {
+                    return {it, std::errc::invalid_argument};
+                }
+
+                ++it;
+            }
+        }
+
+        if (wrapped)
+        {
+            if (it == last || *it != ')')
+            {
+                return {it, std::errc::invalid_argument};
+            }
+
+            it = details::SkipBlanks(it + 1, last);
+        }
+
+        q = Quaternion<T>{components[0], components[1], components[2], components[3]};
+
+        return {it, std::errc{}};
+    }
+
+    namespace details
+    {
+        // Calls f(record, line) for every non-blank line of text.
+        template <typename F>
+        auto ForEachRecord(std::string_view text, std::size_t firstLine, F&& f) -> std::size_t
+        {
+            std::size_t line = firstLine;
+
+            while (!text.empty())
+            {
+                const auto end = text.find('\n');
+                const auto record = text.substr(0, end);
+
+                if (!IsBlankLine(record))
+                {
+                    f(record, line);
+                }
+
+                text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+                ++line;
+            }
+
+            return line - firstLine;
+        }
+
+        template <Arithmetic T>
+        auto ParseRecord(std::string_view record, std::size_t line, Quaternion<T>& q) -> void
+        {
+            const auto result = FromChars(record.data(), record.data() + record.size(), q);
+
+            if (result.ec != std::errc{} || result.ptr != record.data() + record.size())
+            {
+                throw MalformedRecord(line);
+            }
+        }
+    } // namespace details
+
+    // Parses newline separated records and appends them to out. Blank lines are skipped,
+    // firstLine is only used to report the position of a malformed record.
+    template <details::Arithmetic T>
+    auto ParseText(std::string_view text, std::vector<Quaternion<T>>& out, std::size_t firstLine = 1)
+        -> void
+    {
+        details::ForEachRecord(text, firstLine,
+                               [&](std::string_view record, std::size_t line)
+                               {
+                                   Quaternion<T> q;
+                                   details::ParseRecord(record, line, q);
+                                   out.push_back(q);
+                               });
+    }
+
+    template <details::Arithmetic T>
+    [[nodiscard]] auto ParseText(std::string_view text) -> std::vector<Quaternion<T>>
+    {
+        std::vector<Quaternion<T>> out;
+        ParseText(text, out);
+
+        return out;
+    }
+
+    // Splits text into newline aligned chunks that are parsed concurrently. Records are
+    // counted first so every chunk writes straight into its slice of the result.
+    template <details::Arithmetic T>
+    [[nodiscard]] auto ParseTextParallel(std::string_view text, std::size_t threads = 0)
+        -> std::vector<Quaternion<T>>
+    {
+        constexpr std::size_t minChunkSize = std::size_t{1} << 16;
+
+        const auto chunks = details::ThreadCount(threads, text.size() / minChunkSize + 1);
+
+        if (chunks == 1)
+        {
+            return ParseText<T>(text);
+        }
+
+        struct Chunk
+        {
+            std::string_view text;
+            std::size_t lines = 0;
+            std::size_t records = 0;
+        };
+
+        std::vector<Chunk> parts(chunks);
+        std::size_t begin = 0;
+
+        for (std::size_t i = 0; i < chunks; ++i)
+        {
+            auto end = text.size();
+
+            if (i + 1 < chunks)
+            {
+                end = text.find('\n', std::max(begin, (i + 1) * text.size() / chunks));
+                end = end == std::string_view::npos ? text.size() : end + 1;
+            }
+
+            parts[i].text = text.substr(begin, end - begin);
+            begin = end;
+        }
+
+        details::ParallelFor(chunks, chunks, 1,
+                             [&](std::size_t first, std::size_t last)
+                             {
+                                 for (auto i = first; i < last; ++i)
+                                 {
+                                     parts[i].lines = details::ForEachRecord(
+                                         parts[i].text, 0, [&](std::string_view, std::size_t)
+                                         { ++parts[i].records; });
+                                 }
+                             });
+
+        std::vector<std::size_t> offsets(chunks, 0);
+        std::vector<std::size_t> firstLines(chunks, 1);
+
+        for (std::size_t i = 1; i < chunks; ++i)
+        {
+            offsets[i] = offsets[i - 1] + parts[i - 1].records;
+            firstLines[i] = firstLines[i - 1] + parts[i - 1].lines;
+        }
+
+        std::vector<Quaternion<T>> out(offsets.back() + parts.back().records);
+
+        details::ParallelFor(chunks, chunks, 1,
+                             [&](std::size_t first, std::size_t last)
+                             {
+                                 for (auto i = first; i < last; ++i)
+                                 {
+                                     auto* target = out.data() + offsets[i];
+
+                                     details::ForEachRecord(
+                                         parts[i].text, firstLines[i],
+                                         [&](std::string_view record, std::size_t line)
+                                         { details::ParseRecord(record, line, *target++); });
+                                 }
+                             });
+
+        return out;
+    }
+
+    // Incremental parser for data arriving in arbitrary chunks. Only the incomplete
+    // trailing record of each chunk is buffered.
+    template <details::Arithmetic T>
+    class QuaternionStreamParser final
+    {
+    public:
+        auto Feed(std::string_view chunk, std::vector<Quaternion<T>>& out) -> void
+        {
+            if (!_pending.empty())
+            {
+                const auto end = chunk.find('\n');
+
+                if (end == std::string_view::npos)
+                {
+                    _pending.append(chunk);
+                    return;
+                }
+
+                _pending.append(chunk.substr(0, end));
+                ParseText(_pending, out, _line);
+                _pending.clear();
+                ++_line;
+                chunk.remove_prefix(end + 1);
+            }
+
+            const auto last = chunk.rfind('\n');
+
+            if (last == std::string_view::npos)
+            {
+                _pending.assign(chunk);
+                return;
+            }
+
+            const auto complete = chunk.substr(0, last + 1);
+
+            ParseText(complete, out, _line);
+            _line += static_cast<std::size_t>(std::count(complete.begin(), complete.end(), '\n'));
+            _pending.assign(chunk.substr(last + 1));
+        }
+
+        auto Finish(std::vector<Quaternion<T>>& out) -> void
+        {
+            ParseText(_pending, out, _line);
+            _pending.clear();
+            _line = 1;
+        }
+
+    private:
+        std::string _pending;
+        std::size_t _line = 1;
+    };
+
+#if defined(QUATERNIONLIB_HAS_MMAP)
+    // Read-only memory mapping of a whole file.
+    class MappedFile final
+    {
+    public:
+        explicit MappedFile(const std::string& path)
+        {
+            const int fd = ::open(path.c_str(), O_RDONLY);
+
+            if (fd < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "open " + path);
+            }
+
+            struct stat info{};
+
+            if (::fstat(fd, &info) != 0)
+            {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "fstat " + path);
+            }
+
+            _size = static_cast<std::size_t>(info.st_size);
+
+            if (_size != 0)
+            {
+                void* data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (data == MAP_FAILED)
+                {
+                    const int error = errno;
+                    ::close(fd);
+                    throw std::system_error(error, std::generic_category(), "mmap " + path);
+                }
+
+                ::madvise(data, _size, MADV_SEQUENTIAL);
+                _data = static_cast<const char*>(data);
+            }
+
+            ::close(fd);
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        auto operator=(const MappedFile&) -> MappedFile& = delete;
+
+        ~MappedFile() noexcept
+        {
+            if (_data != nullptr)
+            {
+                ::munmap(const_cast<char*>(_data), _size);
+            }
+        }
+
+        [[nodiscard]] auto Text() const noexcept -> std::string_view
+        {
+            return {_data, _size};
+        }
+
+    private:
+        const char* _data = nullptr;
+        std::size_t _size = 0;
+    };
+
+    template <details::Arithmetic T>
+    [[nodiscard]] auto ParseFile(const std::string& path, std::size_t threads = 0)
+        -> std::vector<Quaternion<T>>
+    {
+        const MappedFile file{path};
+
+        return ParseTextParallel<T>(file.Text(), threads);
+    }
+#endif // QUATERNIONLIB_HAS_MMAP
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_PARSE(EXTERN, T)                                                 \
+    EXTERN template auto FromChars<T>(const char*, const char*, Quaternion<T>&) noexcept           \
+        -> std::from_chars_result;                                                                 \
+    EXTERN template auto ParseText<T>(std::string_view, std::vector<Quaternion<T>>&, std::size_t)  \
+        -> void;                                                                                   \
+    EXTERN template auto ParseText<T>(std::string_view) -> std::vector<Quaternion<T>>;             \
+    EXTERN template auto ParseTextParallel<T>(std::string_view, std::size_t)                       \
+        -> std::vector<Quaternion<T>>;                                                             \
+    EXTERN template class QuaternionStreamParser<T>;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_PARSE(extern, float)
+    QUATERNIONLIB_INSTANTIATE_PARSE(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONPARSE_HPP
@@ -0,0 +1,589 @@
+#ifndef QUATERNIONLIB_QUATERNIONPIPELINE_HPP
+#define QUATERNIONLIB_QUATERNIONPIPELINE_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionDistance.hpp"
+#include "QuaternionFormat.hpp"
+#include "QuaternionMath.hpp"
+#include "QuaternionParse.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <stop_token>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Streaming pipelines over orientation data. Stages are coroutines passing chunks of a few
+// thousand quaternions, each stage reusing its own buffer, so a pipeline runs in memory bounded
+// by its chunk size however long the stream.
+namespace quaternionlib
+{
+    // Minimal synchronous generator, an input range over the values passed to co_yield. Each
+    // value lives until the coroutine is resumed, so stages can yield views into their buffers.
+    // std::generator is not available before libstdc++ 14.
+    template <typename T>
+    class Generator final
+    {
+    public:
+        struct promise_type
+        {
+            const T* current = nullptr;
+            std::exception_ptr exception;
+
+            auto get_return_object() noexcept -> Generator
+            {
+                return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+
+            auto initial_suspend() const noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            auto final_suspend() const noexcept -> std::suspend_always
+            {
+                return {};
+            }
+
+            auto yield_value(const T& value) noexcept -> std::suspend_always
+            {
+                current = std::addressof(value);
+                return {};
+            }
+
+            auto return_void() const noexcept -> void
+            {
+            }
+
+            auto unhandled_exception() noexcept -> void
+            {
+                exception = std::current_exception();
+            }
+
+            // Generators only yield.
+            template <typename U>
+            auto await_transform(U&&) -> std::suspend_never = delete;
+        };
+
+        class Iterator
+        {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+
+            Iterator() noexcept = default;
+
+            explicit Iterator(std::coroutine_handle<promise_type> handle) noexcept
+                : _handle(handle)
+            {
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> const T&
+            {
+                return *_handle.promise().current;
+            }
+
+            auto operator++() -> Iterator&
+            {
+                Advance(_handle);
+                return *this;
+            }
+
+            auto operator++(int) -> void
+            {
+                ++*this;
+            }
+
+            [[nodiscard]] friend auto operator==(const Iterator& it,
+                                                 std::default_sentinel_t) noexcept -> bool
+            {
+                return it._handle.done();
+            }
+
+        private:
+            std::coroutine_handle<promise_type> _handle;
+        };
+
+        Generator(Generator&& other) noexcept
+            : _handle(std::exchange(other._handle, {}))
+        {
+        }
+
+        auto operator=(Generator&& other) noexcept -> Generator&
+        {
+            if (this != &other)
+            {
+                Destroy();
+                _handle = std::exchange(other._handle, {});
+            }
+
+            return *this;
+        }
+
+        ~Generator() noexcept
+        {
+            Destroy();
+        }
+
+        // Single pass: runs the coroutine up to its first value.
+        [[nodiscard]] auto begin() -> Iterator
+        {
+            Advance(_handle);
+            return Iterator{_handle};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        explicit Generator(std::coroutine_handle<promise_type> handle) noexcept
+            : _handle(handle)
+        {
+        }
+
+        static auto Advance(std::coroutine_handle<promise_type> handle) -> void
+        {
+            handle.resume();
+
+            if (handle.promise().exception)
+            {
+                std::rethrow_exception(std::exchange(handle.promise().exception, {}));
+            }
+        }
+
+        auto Destroy() noexcept -> void
+        {
+            if (_handle)
+            {
+                _handle.destroy();
+            }
+        }
+
+        std::coroutine_handle<promise_type> _handle;
+    };
+
+    template <details::Arithmetic T>
+    using QuaternionChunk = std::span<const Quaternion<T>>;
+
+    namespace details
+    {
+        // 32 KiB of double quaternions, so a chunk stays in L1/L2 between stages.
+        static inline constexpr std::size_t PIPELINE_CHUNK = 1024;
+        static inline constexpr std::size_t PIPELINE_TEXT_CHUNK = 64 * 1024;
+
+        // Fixed pool of chunk buffers handed from a producer thread to a consumer. The producer
+        // blocks while all buffers are in flight, which is the backpressure of Threaded.
+        template <typename T>
+        class ChunkQueue final
+        {
+        public:
+            explicit ChunkQueue(std::size_t depth)
+                : _buffers(depth)
+            {
+                for (auto& buffer : _buffers)
+                {
+                    buffer.reserve(PIPELINE_CHUNK);
+                    _free.push_back(&buffer);
+                }
+            }
+
+            // nullptr once stop is requested.
+            [[nodiscard]] auto Acquire(std::stop_token stop) -> std::vector<Quaternion<T>>*
+            {
+                std::unique_lock lock{_mutex};
+
+                if (!_changed.wait(lock, stop, [&] { return !_free.empty(); }))
+                {
+                    return nullptr;
+                }
+
+                auto* buffer = _free.front();
+                _free.pop_front();
+
+                return buffer;
+            }
+
+            auto Push(std::vector<Quaternion<T>>* buffer) -> void
+            {
+                {
+                    const std::lock_guard lock{_mutex};
+                    _ready.push_back(buffer);
+                }
+
+                _changed.notify_all();
+            }
+
+            // Next filled buffer, nullptr at the end of the stream.
+            [[nodiscard]] auto Pop() -> std::vector<Quaternion<T>>*
+            {
+                std::unique_lock lock{_mutex};
+                _changed.wait(lock, [&] { return !_ready.empty() || _closed; });
+
+                if (_ready.empty())
+                {
+                    return nullptr;
+                }
+
+                auto* buffer = _ready.front();
+                _ready.pop_front();
+
+                return buffer;
+            }
+
+            auto Release(std::vector<Quaternion<T>>* buffer) -> void
+            {
+                {
+                    const std::lock_guard lock{_mutex};
+                    _free.push_back(buffer);
+                }
+
+                _changed.notify_all();
+            }
+
+            auto Close(std::exception_ptr exception = nullptr) -> void
+            {
+                {
+                    const std::lock_guard lock{_mutex};
+                    _closed = true;
+                    _exception = std::move(exception);
+                }
+
+                _changed.notify_all();
+            }
+
+            auto RethrowIfFailed() -> void
+            {
+                const std::lock_guard lock{_mutex};
+
+                if (_exception)
+                {
+                    std::rethrow_exception(_exception);
+                }
+            }
+
+        private:
+            std::vector<std::vector<Quaternion<T>>> _buffers;
+            std::deque<std::vector<Quaternion<T>>*> _free;
+            std::deque<std::vector<Quaternion<T>>*> _ready;
+            std::mutex _mutex;
+            std::condition_variable_any _changed;
+            bool _closed = false;
+            std::exception_ptr _exception;
+        };
+
+        template <Arithmetic T>
+        auto SpanChunks(std::span<const Quaternion<T>> quaternions, std::size_t chunk)
+            -> Generator<QuaternionChunk<T>>
+        {
+            for (std::size_t offset = 0; offset < quaternions.size(); offset += chunk)
+            {
+                co_yield quaternions.subspan(offset, std::min(chunk, quaternions.size() - offset));
+            }
+        }
+
+        inline auto TextBlocks(std::istream& in, std::size_t bytes) -> Generator<std::string_view>
+        {
+            std::vector<char> buffer(bytes);
+
+            while (in)
+            {
+                in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                const auto count = static_cast<std::size_t>(in.gcount());
+
+                if (count > 0)
+                {
+                    co_yield std::string_view{buffer.data(), count};
+                }
+            }
+        }
+
+        template <Arithmetic T>
+        auto DownsampleChunks(Generator<QuaternionChunk<T>> source, std::size_t factor)
+            -> Generator<QuaternionChunk<T>>
+        {
+            std::vector<Quaternion<T>> buffer;
+            std::size_t phase = 0;
+
+            for (const auto chunk : source)
+            {
+                buffer.clear();
+
+                for (std::size_t i = (factor - phase) % factor; i < chunk.size(); i += factor)
+                {
+                    buffer.push_back(chunk[i]);
+                }
+
+                phase = (phase + chunk.size()) % factor;
+
+                if (!buffer.empty())
+                {
+                    co_yield QuaternionChunk<T>{buffer};
+                }
+            }
+        }
+
+        template <std::floating_point T>
+        auto UpsampleChunks(Generator<QuaternionChunk<T>> source, std::size_t factor)
+            -> Generator<QuaternionChunk<T>>
+        {
+            std::vector<Quaternion<T>> buffer;
+            std::optional<Quaternion<T>> previous;
+
+            for (const auto chunk : source)
+            {
+                buffer.clear();
+
+                for (const auto& q : chunk)
+                {
+                    if (previous)
+                    {
+                        for (std::size_t k = 0; k < factor; ++k)
+                        {
+                            const auto t = static_cast<T>(k) / static_cast<T>(factor);
+                            buffer.push_back(Slerp(*previous, q, t));
+                        }
+                    }
+
+                    previous = q;
+                }
+
+                if (!buffer.empty())
+                {
+                    co_yield QuaternionChunk<T>{buffer};
+                }
+            }
+
+            if (previous)
+            {
+                co_yield QuaternionChunk<T>{&*previous, 1};
+            }
+        }
+
+        template <Arithmetic T>
+        auto ThreadedChunks(Generator<QuaternionChunk<T>> source, std::size_t depth)
+            -> Generator<QuaternionChunk<T>>
+        {
+            ChunkQueue<T> queue{depth};
+
+            // Declared after queue, so it is joined before queue is destroyed.
+            std::jthread worker{[&](std::stop_token stop)
+                                {
+                                    try
+                                    {
+                                        for (const auto chunk : source)
+                                        {
+                                            auto* buffer = queue.Acquire(stop);
+
+                                            if (buffer == nullptr)
+                                            {
+                                                return;
+                                            }
+
+                                            buffer->assign(chunk.begin(), chunk.end());
+                                            queue.Push(buffer);
+                                        }
+
+                                        queue.Close();
+                                    }
+                                    catch (...)
+                                    {
+                                        queue.Close(std::current_exception());
+                                    }
+                                }};
+
+            while (auto* buffer = queue.Pop())
+            {
+                co_yield QuaternionChunk<T>{*buffer};
+                queue.Release(buffer);
+            }
+
+            queue.RethrowIfFailed();
+        }
+    } // namespace details
+
+    namespace pipeline
+    {
+        // Source over quaternions already in memory, yielding subspans without copying.
+        template <details::Arithmetic T>
+        auto Chunks(std::span<const Quaternion<T>> quaternions,
+                    std::size_t chunk = details::PIPELINE_CHUNK) -> Generator<QuaternionChunk<T>>
+        {
+            if (chunk == 0)
+            {
+                throw std::invalid_argument("Chunk size must be positive.");
+            }
+
+            return details::SpanChunks(quaternions, chunk);
+        }
+
+        // Source of raw text blocks from a stream, which must outlive the generator.
+        inline auto ReadText(std::istream& in, std::size_t bytes = details::PIPELINE_TEXT_CHUNK)
+            -> Generator<std::string_view>
+        {
+            if (bytes == 0)
+            {
+                throw std::invalid_argument("Text block size must be positive.");
+            }
+
+            return details::TextBlocks(in, bytes);
+        }
+
+        // Parses text blocks split anywhere, see QuaternionStreamParser for the accepted format.
+        template <details::Arithmetic T>
+        auto Parse(Generator<std::string_view> text) -> Generator<QuaternionChunk<T>>
+        {
+            QuaternionStreamParser<T> parser;
+            std::vector<Quaternion<T>> buffer;
+
+            for (const auto block : text)
+            {
+                buffer.clear();
+                parser.Feed(block, buffer);
+
+                if (!buffer.empty())
+                {
+                    co_yield QuaternionChunk<T>{buffer};
+                }
+            }
+
+            buffer.clear();
+            parser.Finish(buffer);
+
+            if (!buffer.empty())
+            {
+                co_yield QuaternionChunk<T>{buffer};
+            }
+        }
+
+        // Calls f(std::span<Quaternion<T>>) on a copy of each chunk, for stages transforming
+        // quaternions in place, e.g. a filter or a change of frame.
+        template <details::Arithmetic T, typename F>
+        auto Map(Generator<QuaternionChunk<T>> source, F f) -> Generator<QuaternionChunk<T>>
+        {
+            std::vector<Quaternion<T>> buffer;
+
+            for (const auto chunk : source)
+            {
+                buffer.assign(chunk.begin(), chunk.end());
+                f(std::span<Quaternion<T>>{buffer});
+
+                co_yield QuaternionChunk<T>{buffer};
+            }
+        }
+
+        template <std::floating_point T>
+        auto Normalize(Generator<QuaternionChunk<T>> source) -> Generator<QuaternionChunk<T>>
+        {
+            return Map(std::move(source),
+                       [](std::span<Quaternion<T>> chunk)
+                       {
+                           for (auto& q : chunk)
+                           {
+                               q = Normalized<MathPolicy::Fast>(q);
+                           }
+                       });
+        }
+
+        // Keeps every factor-th quaternion of the stream, counted across chunks.
+        template <details::Arithmetic T>
+        auto Downsample(Generator<QuaternionChunk<T>> source, std::size_t factor)
+            -> Generator<QuaternionChunk<T>>
+        {
+            if (factor == 0)
+            {
+                throw std::invalid_argument("Downsampling factor must be positive.");
+            }
+
+            return details::DownsampleChunks(std::move(source), factor);
+        }
+
+        // Inserts factor - 1 Slerp points between consecutive unit quaternions of the stream.
+        template <std::floating_point T>
+        auto Upsample(Generator<QuaternionChunk<T>> source, std::size_t factor)
+            -> Generator<QuaternionChunk<T>>
+        {
+            if (factor == 0)
+            {
+                throw std::invalid_argument("Upsampling factor must be positive.");
+            }
+
+            return details::UpsampleChunks(std::move(source), factor);
+        }
+
+        // Runs source and every stage before it on a worker thread, at most depth chunks ahead
+        // of the consumer. Destroying the generator early stops and joins the worker.
+        template <details::Arithmetic T>
+        auto Threaded(Generator<QuaternionChunk<T>> source, std::size_t depth = 4)
+            -> Generator<QuaternionChunk<T>>
+        {
+            if (depth == 0)
+            {
+                throw std::invalid_argument("Queue depth must be positive.");
+            }
+
+            return details::ThreadedChunks(std::move(source), depth);
+        }
+
+        // Sink writing the stream as text, one record per line or a single JSON array. Returns
+        // the number of quaternions written; throws std::system_error if a chunk does not fit
+        // MaxTextSize.
+        template <details::Arithmetic T>
+        auto Write(Generator<QuaternionChunk<T>> source, std::ostream& out,
+                   const TextFormat& format = {}) -> std::size_t
+        {
+            const bool json = format.layout == TextLayout::Json;
+            std::vector<char> buffer;
+            std::size_t count = 0;
+
+            out << (json ? "[" : "");
+
+            for (const auto chunk : source)
+            {
+                buffer.resize(MaxTextSize<T>(chunk.size(), format));
+
+                const auto result = WriteText(chunk, std::span<char>{buffer}, format);
+
+                if (result.ec != std::errc{})
+                {
+                    throw std::system_error(std::make_error_code(result.ec));
+                }
+
+                std::string_view text{buffer.data(), result.ptr};
+
+                if (json)
+                {
+                    // Chunks are joined into one array.
+                    text = text.substr(1, text.size() - 2);
+                    out << (count > 0 && !text.empty() ? "," : "");
+                }
+
+                out << text;
+                count += chunk.size();
+            }
+
+            out << (json ? "]" : "");
+
+            return count;
+        }
+    } // namespace pipeline
+} // namespace quaternionlib
+
+#endif // QUATERNIONLIB_QUATERNIONPIPELINE_HPP
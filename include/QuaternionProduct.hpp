@@ -0,0 +1,234 @@
+#ifndef QUATERNIONLIB_QUATERNIONPRODUCT_HPP
+#define QUATERNIONLIB_QUATERNIONPRODUCT_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "QuaternionParallel.hpp"
+#include "QuaternionView.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+// Products of one fixed quaternion with many, as a 4x4 matrix applied to each (x, y, z, w).
+namespace quaternionlib
+{
+    namespace details
+    {
+        // Row-major, rows and columns in (x, y, z, w) order.
+        template <std::floating_point T>
+        struct ProductMatrix
+        {
+            T m[4][4];
+        };
+
+        // q * p = L(q) p.
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto LeftProductMatrix(const Quaternion<T>& q) noexcept
+            -> ProductMatrix<T>
+        {
+            const T x = q.X(), y = q.Y(), z = q.Z(), w = q.W();
+
+            return ProductMatrix<T>{{{w, -z, y, x}, {z, w, -x, y}, {-y, x, w, z}, {-x, -y, -z, w}}};
+        }
+
+        // p * q = R(q) p.
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto RightProductMatrix(const Quaternion<T>& q) noexcept
+            -> ProductMatrix<T>
+        {
+            const T x = q.X(), y = q.Y(), z = q.Z(), w = q.W();
+
+            return ProductMatrix<T>{{{w, z, -y, x}, {-z, w, x, y}, {y, -x, w, z}, {-x, -y, -z, w}}};
+        }
+
+        template <std::floating_point T>
+        auto ApplyProductMatrix(const ProductMatrix<T>& matrix, StagedBlock<T>& block) noexcept
+            -> void
+        {
+            // Locals, so the entries are broadcast once instead of reloaded after each store.
+            const T m00 = matrix.m[0][0], m01 = matrix.m[0][1], m02 = matrix.m[0][2],
+                    m03 = matrix.m[0][3];
+            const T m10 = matrix.m[1][0], m11 = matrix.m[1][1], m12 = matrix.m[1][2],
+                    m13 = matrix.m[1][3];
+            const T m20 = matrix.m[2][0], m21 = matrix.m[2][1], m22 = matrix.m[2][2],
+                    m23 = matrix.m[2][3];
+            const T m30 = matrix.m[3][0], m31 = matrix.m[3][1], m32 = matrix.m[3][2],
+                    m33 = matrix.m[3][3];
+
+            for (std::size_t i = 0; i < block.size; ++i)
+            {
+                const T x = block.x[i], y = block.y[i], z = block.z[i], w = block.w[i];
+
+                block.x[i] = m00 * x + m01 * y + m02 * z + m03 * w;
+                block.y[i] = m10 * x + m11 * y + m12 * z + m13 * w;
+                block.z[i] = m20 * x + m21 * y + m22 * z + m23 * w;
+                block.w[i] = m30 * x + m31 * y + m32 * z + m33 * w;
+            }
+        }
+
+        template <std::floating_point T, typename Source, typename Target>
+        auto ApplyProductMatrix(const ProductMatrix<T>& matrix, Source in, Target out,
+                                std::size_t threads) -> void
+        {
+            assert(BatchSize(in) == BatchSize(out));
+
+            ForEachBlock(BatchSize(out), threads, BATCH_MIN_CHUNK,
+                         [&](std::size_t offset, std::size_t count)
+                         {
+                             StagedBlock<T> block{BatchSlice(in, offset, count)};
+                             ApplyProductMatrix(matrix, block);
+                             block.StoreTo(BatchSlice(out, offset, count));
+                         });
+        }
+
+        // AoS needs no staging: each quaternion is a column vector of its own, so the columns of
+        // the matrix are scaled by its components and summed.
+        template <std::floating_point T>
+        auto ApplyProductMatrix(const ProductMatrix<T>& matrix, std::span<const Quaternion<T>> in,
+                                std::span<Quaternion<T>> out, std::size_t threads) -> void
+        {
+            assert(in.size() == out.size());
+
+            ParallelFor(out.size(), threads, BATCH_MIN_CHUNK,
+                        [&, m = matrix](std::size_t begin, std::size_t end)
+                        {
+                            for (std::size_t i = begin; i < end; ++i)
+                            {
+                                const T x = in[i].X(), y = in[i].Y(), z = in[i].Z(),
+                                        w = in[i].W();
+
+                                out[i] = Quaternion<T>{
+                                    m.m[0][0] * x + m.m[0][1] * y + m.m[0][2] * z + m.m[0][3] * w,
+                                    m.m[1][0] * x + m.m[1][1] * y + m.m[1][2] * z + m.m[1][3] * w,
+                                    m.m[2][0] * x + m.m[2][1] * y + m.m[2][2] * z + m.m[2][3] * w,
+                                    m.m[3][0] * x + m.m[3][1] * y + m.m[3][2] * z + m.m[3][3] * w};
+                            }
+                        });
+        }
+    } // namespace details
+
+    // out[i] = q * in[i], in place when in and out are the same array.
+    template <std::floating_point T>
+    auto LeftMultiplyAll(const Quaternion<T>& q, QuaternionSoASpan<const T> in,
+                         QuaternionSoASpan<T> out, std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::LeftProductMatrix(q), in, out, threads);
+    }
+
+    template <std::floating_point T>
+    auto LeftMultiplyAll(const Quaternion<T>& q, QuaternionSoASpan<T> points,
+                         std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::LeftProductMatrix(q), points, points, threads);
+    }
+
+    template <std::floating_point T>
+    auto LeftMultiplyAll(const Quaternion<T>& q, std::span<const Quaternion<T>> in,
+                         std::span<Quaternion<T>> out, std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::LeftProductMatrix(q), in, out, threads);
+    }
+
+    template <std::floating_point T>
+    auto LeftMultiplyAll(const Quaternion<T>& q, std::span<Quaternion<T>> points,
+                         std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::LeftProductMatrix(q),
+                                    std::span<const Quaternion<T>>{points}, points, threads);
+    }
+
+    template <details::MaybeConstArithmetic U, ComponentOrder InOrder, std::size_t InStride,
+              std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    requires std::is_same_v<std::remove_const_t<U>, T>
+    auto LeftMultiplyAll(const Quaternion<T>& q, QuaternionStridedView<U, InOrder, InStride> in,
+                         QuaternionStridedView<T, Order, Stride> out, std::size_t threads = 1)
+        -> void
+    {
+        details::ApplyProductMatrix(details::LeftProductMatrix(q), in, out, threads);
+    }
+
+    template <std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    auto LeftMultiplyAll(const Quaternion<T>& q, QuaternionStridedView<T, Order, Stride> points,
+                         std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::LeftProductMatrix(q), points, points, threads);
+    }
+
+    // out[i] = in[i] * q, in place when in and out are the same array.
+    template <std::floating_point T>
+    auto RightMultiplyAll(QuaternionSoASpan<const T> in, const Quaternion<T>& q,
+                          QuaternionSoASpan<T> out, std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::RightProductMatrix(q), in, out, threads);
+    }
+
+    template <std::floating_point T>
+    auto RightMultiplyAll(QuaternionSoASpan<T> points, const Quaternion<T>& q,
+                          std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::RightProductMatrix(q), points, points, threads);
+    }
+
+    template <std::floating_point T>
+    auto RightMultiplyAll(std::span<const Quaternion<T>> in, const Quaternion<T>& q,
+                          std::span<Quaternion<T>> out, std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::RightProductMatrix(q), in, out, threads);
+    }
+
+    template <std::floating_point T>
+    auto RightMultiplyAll(std::span<Quaternion<T>> points, const Quaternion<T>& q,
+                          std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::RightProductMatrix(q),
+                                    std::span<const Quaternion<T>>{points}, points, threads);
+    }
+
+    template <details::MaybeConstArithmetic U, ComponentOrder InOrder, std::size_t InStride,
+              std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    requires std::is_same_v<std::remove_const_t<U>, T>
+    auto RightMultiplyAll(QuaternionStridedView<U, InOrder, InStride> in, const Quaternion<T>& q,
+                          QuaternionStridedView<T, Order, Stride> out, std::size_t threads = 1)
+        -> void
+    {
+        details::ApplyProductMatrix(details::RightProductMatrix(q), in, out, threads);
+    }
+
+    template <std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    auto RightMultiplyAll(QuaternionStridedView<T, Order, Stride> points, const Quaternion<T>& q,
+                          std::size_t threads = 1) -> void
+    {
+        details::ApplyProductMatrix(details::RightProductMatrix(q), points, points, threads);
+    }
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_PRODUCT(EXTERN, T)                                               \
+    EXTERN template auto LeftMultiplyAll<T>(const Quaternion<T>&, QuaternionSoASpan<const T>,      \
+                                            QuaternionSoASpan<T>, std::size_t) -> void;            \
+    EXTERN template auto LeftMultiplyAll<T>(const Quaternion<T>&, QuaternionSoASpan<T>,            \
+                                            std::size_t) -> void;                                  \
+    EXTERN template auto LeftMultiplyAll<T>(const Quaternion<T>&, std::span<const Quaternion<T>>,  \
+                                            std::span<Quaternion<T>>, std::size_t) -> void;        \
+    EXTERN template auto LeftMultiplyAll<T>(const Quaternion<T>&, std::span<Quaternion<T>>,        \
+                                            std::size_t) -> void;                                  \
+    EXTERN template auto RightMultiplyAll<T>(QuaternionSoASpan<const T>, const Quaternion<T>&,     \
+                                             QuaternionSoASpan<T>, std::size_t) -> void;           \
+    EXTERN template auto RightMultiplyAll<T>(QuaternionSoASpan<T>, const Quaternion<T>&,           \
+                                             std::size_t) -> void;                                 \
+    EXTERN template auto RightMultiplyAll<T>(std::span<const Quaternion<T>>, const Quaternion<T>&, \
+                                             std::span<Quaternion<T>>, std::size_t) -> void;       \
+    EXTERN template auto RightMultiplyAll<T>(std::span<Quaternion<T>>, const Quaternion<T>&,       \
+                                             std::size_t) -> void;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_PRODUCT(extern, float)
+    QUATERNIONLIB_INSTANTIATE_PRODUCT(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONPRODUCT_HPP
@@ -0,0 +1,353 @@
+#ifndef QUATERNIONLIB_QUATERNIONRANDOM_HPP
+#define QUATERNIONLIB_QUATERNIONRANDOM_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+
+// Counter-based random rotations: sample i is a pure function of (seed, i), so results do not
+// depend on how the index range is split across calls or threads.
+namespace quaternionlib
+{
+    namespace details
+    {
+        struct PhiloxBlock
+        {
+            std::uint32_t v[4];
+        };
+
+        // Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+        [[nodiscard]] constexpr auto Philox4x32(std::uint64_t counter, std::uint32_t stream,
+                                                std::uint64_t key) noexcept -> PhiloxBlock
+        {
+            constexpr std::uint64_t m0 = 0xD2511F53;
+            constexpr std::uint64_t m1 = 0xCD9E8D57;
+            constexpr std::uint32_t w0 = 0x9E3779B9;
+            constexpr std::uint32_t w1 = 0xBB67AE85;
+
+            std::uint32_t c0 = static_cast<std::uint32_t>(counter);
+            std::uint32_t c1 = static_cast<std::uint32_t>(counter >> 32);
+            std::uint32_t c2 = stream;
+            std::uint32_t c3 = 0;
+            std::uint32_t k0 = static_cast<std::uint32_t>(key);
+            std::uint32_t k1 = static_cast<std::uint32_t>(key >> 32);
+
+            for (int round = 0; round < 10; ++round)
+            {
+                const std::uint64_t p0 = m0 * c0;
+                const std::uint64_t p1 = m1 * c2;
+
+                const auto hi0 = static_cast<std::uint32_t>(p0 >> 32);
+                const auto lo0 = static_cast<std::uint32_t>(p0);
+                const auto hi1 = static_cast<std::uint32_t>(p1 >> 32);
+                const auto lo1 = static_cast<std::uint32_t>(p1);
+
+                c0 = hi1 ^ c1 ^ k0;
+                c1 = lo1;
+                c2 = hi0 ^ c3 ^ k1;
+                c3 = lo0;
+
+                k0 += w0;
+                k1 += w1;
+            }
+
+            return {{c0, c1, c2, c3}};
+        }
+
+        // Maps random bits to the open interval (0, 1), keeping as many leading bits as T holds
+        // exactly with the half-step offset, 23 for float, so the largest value stays below 1.
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto ToUnitInterval(std::uint32_t bits) noexcept -> T
+        {
+            constexpr int used = std::min(32, std::numeric_limits<T>::digits - 1);
+            constexpr T step = static_cast<T>(1) / static_cast<T>(std::uint64_t{1} << used);
+
+            return (static_cast<T>(bits >> (32 - used)) + static_cast<T>(0.5)) * step;
+        }
+
+        // Cube root for x > 0 from an exponent-dividing initial guess and Newton steps.
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto Cbrt(T x) noexcept -> T
+        {
+            T y;
+
+            if constexpr (sizeof(T) == sizeof(std::uint32_t) && std::numeric_limits<T>::is_iec559)
+            {
+                y = std::bit_cast<T>(std::bit_cast<std::uint32_t>(x) / 3 + 0x2A5137A0u);
+            }
+            else if constexpr (sizeof(T) == sizeof(std::uint64_t) &&
+                               std::numeric_limits<T>::is_iec559)
+            {
+                y = std::bit_cast<T>(std::bit_cast<std::uint64_t>(x) / 3 +
+                                     std::uint64_t{0x2A9F7893782DA1CE});
+            }
+            else
+            {
+                return std::cbrt(x);
+            }
+
+            for (int i = 0; i < 4; ++i)
+            {
+                y = (2 * y + x / (y * y)) / 3;
+            }
+
+            return y;
+        }
+
+        enum class RandomStream : std::uint32_t
+        {
+            Uniform = 0,
+            Perturbation = 1
+        };
+
+        // Shoemake's subgroup algorithm for indices firstIndex, firstIndex + 1, ... of the
+        // uniform stream.
+        template <std::floating_point T>
+        auto UniformRotationBlock(std::uint64_t key, std::uint64_t firstIndex,
+                                  StagedBlock<T>& out) noexcept -> void
+        {
+            for (std::size_t i = 0; i < out.size; ++i)
+            {
+                const PhiloxBlock bits = Philox4x32(
+                    firstIndex + i, static_cast<std::uint32_t>(RandomStream::Uniform), key);
+
+                const T u1 = ToUnitInterval<T>(bits.v[0]);
+                const T a = FastSqrt(1 - u1);
+                const T b = FastSqrt(u1);
+
+                T s2, c2, s3, c3;
+                SinCos2Pi(ToUnitInterval<T>(bits.v[1]), s2, c2);
+                SinCos2Pi(ToUnitInterval<T>(bits.v[2]), s3, c3);
+
+                out.x[i] = a * s2;
+                out.y[i] = a * c2;
+                out.z[i] = b * s3;
+                out.w[i] = b * c3;
+            }
+        }
+
+        // Rotations by an angle distributed as the Haar measure restricted to angles below
+        // maxAngle (density proportional to 1 - cos(angle)) about uniformly random axes, for
+        // indices firstIndex, firstIndex + 1, ... of the perturbation stream.
+        template <std::floating_point T>
+        auto CappedRotationBlock(std::uint64_t key, std::uint64_t firstIndex, T maxAngle,
+                                 T capMass, StagedBlock<T>& out) noexcept -> void
+        {
+            constexpr T twoPi = 2 * std::numbers::pi_v<T>;
+
+            const std::size_t n = out.size;
+            T target[BATCH_BLOCK];
+            T refine[BATCH_BLOCK];
+            T angle[BATCH_BLOCK];
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const PhiloxBlock bits = Philox4x32(
+                    firstIndex + i, static_cast<std::uint32_t>(RandomStream::Perturbation), key);
+
+                // Solve angle - sin(angle) = target; the cube root is the small-angle solution.
+                // Below 1e-3 rad it is already exact to rounding, while Newton's f and slope
+                // lose every significant digit to cancellation.
+                target[i] = ToUnitInterval<T>(bits.v[0]) * capMass;
+                angle[i] = std::min(Cbrt(6 * target[i]), maxAngle);
+                refine[i] = static_cast<T>(angle[i] > static_cast<T>(1e-3));
+
+                const T axisZ = 2 * ToUnitInterval<T>(bits.v[1]) - 1;
+                const T radius = FastSqrt(1 - axisZ * axisZ);
+
+                T sp, cp;
+                SinCos2Pi(ToUnitInterval<T>(bits.v[2]), sp, cp);
+
+                out.x[i] = radius * cp;
+                out.y[i] = radius * sp;
+                out.z[i] = axisZ;
+            }
+
+            // Newton converges from the cube-root guess to rounding within four steps for every
+            // maxAngle up to pi.
+            for (int iteration = 0; iteration < 4; ++iteration)
+            {
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    T halfSin, halfCos;
+                    SinCos2Pi(angle[i] / (2 * twoPi), halfSin, halfCos);
+
+                    const T f = angle[i] - 2 * halfSin * halfCos - target[i];
+                    const T slope = 2 * halfSin * halfSin;
+
+                    // Masked lanes divide 0 by a nonzero value instead of branching.
+                    angle[i] -= f * refine[i] / (slope + (1 - refine[i]));
+                    angle[i] = std::clamp(angle[i], T{}, maxAngle);
+                }
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                T sh, ch;
+                SinCos2Pi(angle[i] / (2 * twoPi), sh, ch);
+
+                out.x[i] *= sh;
+                out.y[i] *= sh;
+                out.z[i] *= sh;
+                out.w[i] = ch;
+            }
+        }
+    } // namespace details
+
+    template <std::floating_point T>
+    class RandomRotationGenerator final
+    {
+    public:
+        explicit constexpr RandomRotationGenerator(std::uint64_t seed) noexcept
+            : _seed(seed)
+        {
+        }
+
+        [[nodiscard]] constexpr auto Seed() const noexcept -> std::uint64_t
+        {
+            return _seed;
+        }
+
+        // Uniformly distributed unit quaternion number index of this generator's sequence.
+        [[nodiscard]] auto operator()(std::uint64_t index) const noexcept -> Quaternion<T>
+        {
+            details::StagedBlock<T> block{1};
+            details::UniformRotationBlock(_seed, index, block);
+
+            return Quaternion<T>{block.x[0], block.y[0], block.z[0], block.w[0]};
+        }
+
+        // Fills out with samples firstIndex, firstIndex + 1, ...
+        auto Generate(QuaternionSoASpan<T> out, std::uint64_t firstIndex = 0,
+                      std::size_t threads = 1) const -> void
+        {
+            GenerateBlocks(out, firstIndex, threads);
+        }
+
+        auto Generate(std::span<Quaternion<T>> out, std::uint64_t firstIndex = 0,
+                      std::size_t threads = 1) const -> void
+        {
+            GenerateBlocks(out, firstIndex, threads);
+        }
+
+        template <ComponentOrder Order, std::size_t Stride>
+        auto Generate(QuaternionStridedView<T, Order, Stride> out, std::uint64_t firstIndex = 0,
+                      std::size_t threads = 1) const -> void
+        {
+            GenerateBlocks(out, firstIndex, threads);
+        }
+
+        // Rotations uniformly distributed (w.r.t. the Haar measure) over all rotations within
+        // maxAngle radians of mean, i.e. mean * delta with angle(delta) <= maxAngle <= pi.
+        // Perturbations use their own stream, independent of the uniform samples.
+        [[nodiscard]] auto Perturbation(const Quaternion<T>& mean, T maxAngle,
+                                        std::uint64_t index) const noexcept -> Quaternion<T>
+        {
+            details::StagedBlock<T> block{1};
+            details::CappedRotationBlock(_seed, index, ClampAngle(maxAngle), CapMass(maxAngle),
+                                         block);
+
+            return mean * Quaternion<T>{block.x[0], block.y[0], block.z[0], block.w[0]};
+        }
+
+        auto Perturb(const Quaternion<T>& mean, T maxAngle, QuaternionSoASpan<T> out,
+                     std::uint64_t firstIndex = 0, std::size_t threads = 1) const -> void
+        {
+            PerturbBlocks(mean, maxAngle, out, firstIndex, threads);
+        }
+
+        auto Perturb(const Quaternion<T>& mean, T maxAngle, std::span<Quaternion<T>> out,
+                     std::uint64_t firstIndex = 0, std::size_t threads = 1) const -> void
+        {
+            PerturbBlocks(mean, maxAngle, out, firstIndex, threads);
+        }
+
+        template <ComponentOrder Order, std::size_t Stride>
+        auto Perturb(const Quaternion<T>& mean, T maxAngle,
+                     QuaternionStridedView<T, Order, Stride> out, std::uint64_t firstIndex = 0,
+                     std::size_t threads = 1) const -> void
+        {
+            PerturbBlocks(mean, maxAngle, out, firstIndex, threads);
+        }
+
+    private:
+        [[nodiscard]] static constexpr auto ClampAngle(T maxAngle) noexcept -> T
+        {
+            return std::clamp(maxAngle, T{}, std::numbers::pi_v<T>);
+        }
+
+        [[nodiscard]] static auto CapMass(T maxAngle) noexcept -> T
+        {
+            const T angle = ClampAngle(maxAngle);
+
+            return angle - std::sin(angle);
+        }
+
+        template <typename Out>
+        auto GenerateBlocks(Out out, std::uint64_t firstIndex, std::size_t threads) const -> void
+        {
+            details::ForEachBlock(details::BatchSize(out), threads, details::BATCH_MIN_CHUNK,
+                                  [&](std::size_t offset, std::size_t count)
+                                  {
+                                      details::StagedBlock<T> block{count};
+                                      details::UniformRotationBlock(_seed, firstIndex + offset,
+                                                                    block);
+                                      block.StoreTo(details::BatchSlice(out, offset, count));
+                                  });
+        }
+
+        template <typename Out>
+        auto PerturbBlocks(const Quaternion<T>& mean, T maxAngle, Out out,
+                           std::uint64_t firstIndex, std::size_t threads) const -> void
+        {
+            const T angle = ClampAngle(maxAngle);
+            const T mass = CapMass(maxAngle);
+
+            details::ForEachBlock(details::BatchSize(out), threads, details::BATCH_MIN_CHUNK,
+                                  [&](std::size_t offset, std::size_t count)
+                                  {
+                                      details::StagedBlock<T> block{count};
+                                      details::CappedRotationBlock(_seed, firstIndex + offset,
+                                                                   angle, mass, block);
+
+                                      for (std::size_t i = 0; i < count; ++i)
+                                      {
+                                          const Quaternion<T> q =
+                                              mean * Quaternion<T>{block.x[i], block.y[i],
+                                                                   block.z[i], block.w[i]};
+
+                                          block.x[i] = q.X();
+                                          block.y[i] = q.Y();
+                                          block.z[i] = q.Z();
+                                          block.w[i] = q.W();
+                                      }
+
+                                      block.StoreTo(details::BatchSlice(out, offset, count));
+                                  });
+        }
+
+        std::uint64_t _seed;
+    };
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_RANDOM(EXTERN, T)                                                \
+    EXTERN template class RandomRotationGenerator<T>;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_RANDOM(extern, float)
+    QUATERNIONLIB_INSTANTIATE_RANDOM(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONRANDOM_HPP
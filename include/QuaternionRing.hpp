@@ -0,0 +1,378 @@
+#ifndef QUATERNIONLIB_QUATERNIONRING_HPP
+#define QUATERNIONLIB_QUATERNIONRING_HPP
+
+#include "Quaternion.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define QUATERNIONLIB_HAS_SHM 1
+#endif
+
+// Single-producer, multi-consumer ring of timestamped orientations in POSIX shared memory.
+namespace quaternionlib
+{
+    // Fixed-layout record, the same in every process mapping the ring.
+    template <details::Arithmetic T>
+    struct StampedQuaternion
+    {
+        std::int64_t timestamp;
+        T x, y, z, w;
+
+        [[nodiscard]] constexpr auto Orientation() const noexcept -> Quaternion<T>
+        {
+            return Quaternion<T>{x, y, z, w};
+        }
+    };
+
+#if defined(QUATERNIONLIB_HAS_SHM)
+    enum class RingRead
+    {
+        Ready,
+        // Nothing published since the last record read.
+        Empty,
+        // The producer overwrote records before they were read. The reader skipped ahead to the
+        // oldest record still in the ring and counts the skipped ones in Lost().
+        Overrun
+    };
+
+    namespace details
+    {
+        static inline constexpr std::uint64_t RING_MAGIC = 0x5152494E47000001; // "QRING", v1
+
+        // Identifies T across processes built from different sources.
+        template <typename T>
+        static inline constexpr std::uint32_t RING_TYPE_TAG =
+            (std::is_floating_point_v<T> ? 0x10000u : 0u) | (std::is_signed_v<T> ? 0x100u : 0u) |
+            static_cast<std::uint32_t>(sizeof(T));
+
+        struct RingHeader
+        {
+            // Stored last by the producer, so a reader seeing it sees the fields below.
+            std::atomic<std::uint64_t> magic;
+            std::uint64_t capacity;
+            std::uint32_t recordSize;
+            std::uint32_t typeTag;
+            // Records published. On its own cache line, the only field written per record.
+            alignas(64) std::atomic<std::uint64_t> head;
+        };
+
+        // Per-slot seqlock: 2n + 1 while record n is written, 2n + 2 once it is complete and 0
+        // before the first lap.
+        template <typename T>
+        struct RingSlot
+        {
+            std::atomic<std::uint64_t> sequence;
+            StampedQuaternion<T> record;
+        };
+
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                      "Shared memory rings require address-free 64-bit atomics.");
+
+        template <typename T>
+        [[nodiscard]] constexpr auto RingBytes(std::uint64_t capacity) noexcept -> std::size_t
+        {
+            return sizeof(RingHeader) + static_cast<std::size_t>(capacity) * sizeof(RingSlot<T>);
+        }
+
+        // Owns a shared mapping; unmaps it when destroyed.
+        class SharedMapping final
+        {
+        public:
+            SharedMapping(int fd, std::size_t size, int protection, const std::string& name)
+                : _size(size)
+            {
+                _data = ::mmap(nullptr, size, protection, MAP_SHARED, fd, 0);
+
+                if (_data == MAP_FAILED)
+                {
+                    throw std::system_error(errno, std::generic_category(), "mmap " + name);
+                }
+            }
+
+            SharedMapping(const SharedMapping&) = delete;
+            auto operator=(const SharedMapping&) -> SharedMapping& = delete;
+
+            ~SharedMapping() noexcept
+            {
+                ::munmap(_data, _size);
+            }
+
+            [[nodiscard]] auto Data() const noexcept -> void*
+            {
+                return _data;
+            }
+
+        private:
+            void* _data = nullptr;
+            std::size_t _size = 0;
+        };
+    } // namespace details
+
+    // Creates the ring and publishes into it. name follows shm_open, e.g. "/imu"; the ring is
+    // removed from the namespace when the writer is destroyed, readers keep their mapping.
+    template <details::Arithmetic T>
+    class SharedRingWriter final
+    {
+    public:
+        SharedRingWriter(std::string name, std::size_t capacity)
+            : _name(std::move(name)), _mask(capacity - 1)
+        {
+            if (!std::has_single_bit(capacity))
+            {
+                throw std::invalid_argument("Ring capacity must be a power of two.");
+            }
+
+            const int fd = ::shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+
+            if (fd < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "shm_open " + _name);
+            }
+
+            const auto size = details::RingBytes<T>(capacity);
+
+            try
+            {
+                if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+                {
+                    throw std::system_error(errno, std::generic_category(), "ftruncate " + _name);
+                }
+
+                _mapping.emplace(fd, size, PROT_READ | PROT_WRITE, _name);
+            }
+            catch (...)
+            {
+                ::close(fd);
+                ::shm_unlink(_name.c_str());
+                throw;
+            }
+
+            ::close(fd);
+
+            // ftruncate zero-fills, so every slot starts at sequence 0 and head at 0.
+            _header = static_cast<details::RingHeader*>(_mapping->Data());
+            _slots = reinterpret_cast<details::RingSlot<T>*>(_header + 1);
+            _header->capacity = capacity;
+            _header->recordSize = sizeof(StampedQuaternion<T>);
+            _header->typeTag = details::RING_TYPE_TAG<T>;
+            _header->magic.store(details::RING_MAGIC, std::memory_order_release);
+        }
+
+        SharedRingWriter(const SharedRingWriter&) = delete;
+        auto operator=(const SharedRingWriter&) -> SharedRingWriter& = delete;
+
+        ~SharedRingWriter() noexcept
+        {
+            ::shm_unlink(_name.c_str());
+        }
+
+        // Wait-free; overwrites the oldest record once the ring is full.
+        auto Publish(const StampedQuaternion<T>& record) noexcept -> void
+        {
+            auto& slot = _slots[_next & _mask];
+
+            slot.sequence.store(2 * _next + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.record = record;
+            slot.sequence.store(2 * _next + 2, std::memory_order_release);
+
+            ++_next;
+            _header->head.store(_next, std::memory_order_release);
+        }
+
+        auto Publish(std::int64_t timestamp, const Quaternion<T>& q) noexcept -> void
+        {
+            Publish(StampedQuaternion<T>{timestamp, q.X(), q.Y(), q.Z(), q.W()});
+        }
+
+        [[nodiscard]] auto Capacity() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(_mask + 1);
+        }
+
+        [[nodiscard]] auto Published() const noexcept -> std::uint64_t
+        {
+            return _next;
+        }
+
+    private:
+        std::string _name;
+        std::uint64_t _mask;
+        std::optional<details::SharedMapping> _mapping;
+        details::RingHeader* _header = nullptr;
+        details::RingSlot<T>* _slots = nullptr;
+        std::uint64_t _next = 0;
+    };
+
+    // Independent consumer of a ring, mapped read-only. Starts at the next record published.
+    template <details::Arithmetic T>
+    class SharedRingReader final
+    {
+    public:
+        explicit SharedRingReader(const std::string& name)
+        {
+            const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+
+            if (fd < 0)
+            {
+                throw std::system_error(errno, std::generic_category(), "shm_open " + name);
+            }
+
+            struct stat info{};
+
+            try
+            {
+                if (::fstat(fd, &info) != 0)
+                {
+                    throw std::system_error(errno, std::generic_category(), "fstat " + name);
+                }
+
+                if (static_cast<std::size_t>(info.st_size) < sizeof(details::RingHeader))
+                {
+                    throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                                            "Not a quaternion ring: " + name);
+                }
+
+                _mapping.emplace(fd, static_cast<std::size_t>(info.st_size), PROT_READ, name);
+            }
+            catch (...)
+            {
+                ::close(fd);
+                throw;
+            }
+
+            ::close(fd);
+
+            _header = static_cast<const details::RingHeader*>(_mapping->Data());
+
+            // Checked before reading any other field, see RingHeader.
+            if (_header->magic.load(std::memory_order_acquire) != details::RING_MAGIC)
+            {
+                throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                                        "Not a quaternion ring of this type: " + name);
+            }
+
+            const auto capacity = _header->capacity;
+
+            if (!std::has_single_bit(capacity) ||
+                details::RingBytes<T>(capacity) != static_cast<std::size_t>(info.st_size) ||
+                _header->recordSize != sizeof(StampedQuaternion<T>) ||
+                _header->typeTag != details::RING_TYPE_TAG<T>)
+            {
+                throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                                        "Not a quaternion ring of this type: " + name);
+            }
+
+            _slots = reinterpret_cast<const details::RingSlot<T>*>(_header + 1);
+            _mask = capacity - 1;
+            _next = _header->head.load(std::memory_order_acquire);
+        }
+
+        SharedRingReader(const SharedRingReader&) = delete;
+        auto operator=(const SharedRingReader&) -> SharedRingReader& = delete;
+
+        // Calls visit(const StampedQuaternion<T>&) on the next record in place, without copying
+        // it out of the ring. The record is validated after visit returns: on Overrun the
+        // producer may have been writing it meanwhile, so whatever visit derived must be dropped.
+        template <typename Visitor>
+        auto Read(Visitor&& visit) -> RingRead
+        {
+            const auto& slot = _slots[_next & _mask];
+            const auto complete = 2 * _next + 2;
+            const auto before = slot.sequence.load(std::memory_order_acquire);
+
+            if (before < complete)
+            {
+                return RingRead::Empty;
+            }
+
+            if (before == complete)
+            {
+                visit(slot.record);
+                std::atomic_thread_fence(std::memory_order_acquire);
+
+                if (slot.sequence.load(std::memory_order_relaxed) == complete)
+                {
+                    ++_next;
+
+                    return RingRead::Ready;
+                }
+            }
+
+            SkipOverwritten();
+
+            return RingRead::Overrun;
+        }
+
+        // Records published but not yet read, more than Capacity() once overrun.
+        [[nodiscard]] auto Available() const noexcept -> std::uint64_t
+        {
+            return _header->head.load(std::memory_order_acquire) - _next;
+        }
+
+        [[nodiscard]] auto Capacity() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(_mask + 1);
+        }
+
+        // Records overwritten before this reader got to them.
+        [[nodiscard]] auto Lost() const noexcept -> std::uint64_t
+        {
+            return _lost;
+        }
+
+    private:
+        // The slot after head may already be rewritten, so the oldest safe record is one later.
+        auto SkipOverwritten() noexcept -> void
+        {
+            const auto head = _header->head.load(std::memory_order_acquire);
+            const auto oldest = head > _mask ? head - _mask : 0;
+            const auto next = std::max(_next + 1, oldest);
+
+            _lost += next - _next;
+            _next = next;
+        }
+
+        std::optional<details::SharedMapping> _mapping;
+        const details::RingHeader* _header = nullptr;
+        const details::RingSlot<T>* _slots = nullptr;
+        std::uint64_t _mask = 0;
+        std::uint64_t _next = 0;
+        std::uint64_t _lost = 0;
+    };
+#endif // QUATERNIONLIB_HAS_SHM
+} // namespace quaternionlib
+
+#if defined(QUATERNIONLIB_HAS_SHM)
+#define QUATERNIONLIB_INSTANTIATE_RING(EXTERN, T)                                                  \
+    EXTERN template class SharedRingWriter<T>;                                                     \
+    EXTERN template class SharedRingReader<T>;
+#else
+#define QUATERNIONLIB_INSTANTIATE_RING(EXTERN, T)
+#endif
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_RING(extern, float)
+    QUATERNIONLIB_INSTANTIATE_RING(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONRING_HPP
@@ -0,0 +1,332 @@
+#ifndef QUATERNIONLIB_QUATERNIONSPARSE_HPP
+#define QUATERNIONLIB_QUATERNIONSPARSE_HPP
+
+#include "Quaternion.hpp"
+
+#include <cmath>
+#include <concepts>
+#include <type_traits>
+
+// Quaternions with components known to be zero at compile time. Products involving them skip
+// the zero terms of the Hamilton product instead of multiplying by literal zeros, which the
+// compiler may not fold away under IEEE semantics.
+namespace quaternionlib
+{
+    // Quaternion with w == 0, i.e. a 3D vector lifted for rotation.
+    template <details::Arithmetic T>
+    class PureQuaternion final
+    {
+    public:
+        using value_type = T;
+
+        constexpr PureQuaternion() noexcept = default;
+
+        constexpr PureQuaternion(const T& x, const T& y, const T& z) noexcept
+            : _x(x), _y(y), _z(z)
+        {
+        }
+
+        [[nodiscard]] constexpr auto X() const noexcept -> T
+        {
+            return _x;
+        }
+
+        [[nodiscard]] constexpr auto Y() const noexcept -> T
+        {
+            return _y;
+        }
+
+        [[nodiscard]] constexpr auto Z() const noexcept -> T
+        {
+            return _z;
+        }
+
+        [[nodiscard]] constexpr auto W() const noexcept -> T
+        {
+            return T{};
+        }
+
+        [[nodiscard]] constexpr auto SquaredNorm() const noexcept -> T
+        {
+            return (_x * _x) + (_y * _y) + (_z * _z);
+        }
+
+        [[nodiscard]] constexpr auto Norm() const noexcept -> T
+        {
+            return static_cast<T>(details::Sqrt(SquaredNorm()));
+        }
+
+        constexpr operator Quaternion<T>() const noexcept
+        {
+            return Quaternion<T>{_x, _y, _z, T{}};
+        }
+
+    private:
+        T _x{}, _y{}, _z{};
+    };
+
+    enum class Axis
+    {
+        X,
+        Y,
+        Z
+    };
+
+    // Quaternion with a single non-zero vector component, e.g. a rotation about a basis axis.
+    template <details::Arithmetic T, Axis A>
+    class AxisQuaternion final
+    {
+    public:
+        using value_type = T;
+        static constexpr Axis axis = A;
+
+        constexpr AxisQuaternion() noexcept = default;
+
+        constexpr AxisQuaternion(const T& component, const T& w) noexcept
+            : _v(component), _w(w)
+        {
+        }
+
+        [[nodiscard]] static constexpr auto FromAngle(const T& angle) noexcept
+            -> AxisQuaternion<T, A>
+        requires std::floating_point<T>
+        {
+            return AxisQuaternion<T, A>{details::Sin(angle / 2), details::Cos(angle / 2)};
+        }
+
+        // The single vector component, along A.
+        [[nodiscard]] constexpr auto V() const noexcept -> T
+        {
+            return _v;
+        }
+
+        [[nodiscard]] constexpr auto X() const noexcept -> T
+        {
+            return A == Axis::X ? _v : T{};
+        }
+
+        [[nodiscard]] constexpr auto Y() const noexcept -> T
+        {
+            return A == Axis::Y ? _v : T{};
+        }
+
+        [[nodiscard]] constexpr auto Z() const noexcept -> T
+        {
+            return A == Axis::Z ? _v : T{};
+        }
+
+        [[nodiscard]] constexpr auto W() const noexcept -> T
+        {
+            return _w;
+        }
+
+        [[nodiscard]] constexpr auto Conjugated() const noexcept -> AxisQuaternion<T, A>
+        {
+            return AxisQuaternion<T, A>{-_v, _w};
+        }
+
+        constexpr operator Quaternion<T>() const noexcept
+        {
+            return Quaternion<T>{X(), Y(), Z(), _w};
+        }
+
+    private:
+        T _v{}, _w{};
+    };
+
+    template <typename T>
+    using XAxisQuaternion = AxisQuaternion<T, Axis::X>;
+
+    template <typename T>
+    using YAxisQuaternion = AxisQuaternion<T, Axis::Y>;
+
+    template <typename T>
+    using ZAxisQuaternion = AxisQuaternion<T, Axis::Z>;
+
+    // 12 multiplications instead of 16
+    template <details::Arithmetic T, details::Arithmetic U>
+    [[nodiscard]] constexpr auto operator*(const Quaternion<T>& lhs, const PureQuaternion<U>& rhs)
+        -> Quaternion<std::common_type_t<T, U>>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V x1 = lhs.X(), y1 = lhs.Y(), z1 = lhs.Z(), w1 = lhs.W();
+        const V x2 = rhs.X(), y2 = rhs.Y(), z2 = rhs.Z();
+
+        return Quaternion<V>{w1 * x2 + y1 * z2 - z1 * y2, w1 * y2 - x1 * z2 + z1 * x2,
+                             w1 * z2 + x1 * y2 - y1 * x2, -x1 * x2 - y1 * y2 - z1 * z2};
+    }
+
+    template <details::Arithmetic T, details::Arithmetic U>
+    [[nodiscard]] constexpr auto operator*(const PureQuaternion<T>& lhs, const Quaternion<U>& rhs)
+        -> Quaternion<std::common_type_t<T, U>>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V x1 = lhs.X(), y1 = lhs.Y(), z1 = lhs.Z();
+        const V x2 = rhs.X(), y2 = rhs.Y(), z2 = rhs.Z(), w2 = rhs.W();
+
+        return Quaternion<V>{x1 * w2 + y1 * z2 - z1 * y2, -x1 * z2 + y1 * w2 + z1 * x2,
+                             x1 * y2 - y1 * x2 + z1 * w2, -x1 * x2 - y1 * y2 - z1 * z2};
+    }
+
+    // Cross product minus dot product, 9 multiplications
+    template <details::Arithmetic T, details::Arithmetic U>
+    [[nodiscard]] constexpr auto operator*(const PureQuaternion<T>& lhs,
+                                           const PureQuaternion<U>& rhs)
+        -> Quaternion<std::common_type_t<T, U>>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V x1 = lhs.X(), y1 = lhs.Y(), z1 = lhs.Z();
+        const V x2 = rhs.X(), y2 = rhs.Y(), z2 = rhs.Z();
+
+        return Quaternion<V>{y1 * z2 - z1 * y2, z1 * x2 - x1 * z2, x1 * y2 - y1 * x2,
+                             -x1 * x2 - y1 * y2 - z1 * z2};
+    }
+
+    // 8 multiplications
+    template <details::Arithmetic T, details::Arithmetic U, Axis A>
+    [[nodiscard]] constexpr auto operator*(const Quaternion<T>& lhs, const AxisQuaternion<U, A>& rhs)
+        -> Quaternion<std::common_type_t<T, U>>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V x = lhs.X(), y = lhs.Y(), z = lhs.Z(), w = lhs.W();
+        const V a = rhs.V(), b = rhs.W();
+
+        if constexpr (A == Axis::X)
+        {
+            return Quaternion<V>{w * a + x * b, y * b + z * a, z * b - y * a, w * b - x * a};
+        }
+        else if constexpr (A == Axis::Y)
+        {
+            return Quaternion<V>{x * b - z * a, w * a + y * b, x * a + z * b, w * b - y * a};
+        }
+        else
+        {
+            return Quaternion<V>{x * b + y * a, y * b - x * a, w * a + z * b, w * b - z * a};
+        }
+    }
+
+    // 8 multiplications
+    template <details::Arithmetic T, details::Arithmetic U, Axis A>
+    [[nodiscard]] constexpr auto operator*(const AxisQuaternion<T, A>& lhs, const Quaternion<U>& rhs)
+        -> Quaternion<std::common_type_t<T, U>>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V a = lhs.V(), b = lhs.W();
+        const V x = rhs.X(), y = rhs.Y(), z = rhs.Z(), w = rhs.W();
+
+        if constexpr (A == Axis::X)
+        {
+            return Quaternion<V>{b * x + a * w, b * y - a * z, b * z + a * y, b * w - a * x};
+        }
+        else if constexpr (A == Axis::Y)
+        {
+            return Quaternion<V>{b * x + a * z, b * y + a * w, b * z - a * x, b * w - a * y};
+        }
+        else
+        {
+            return Quaternion<V>{b * x - a * y, b * y + a * x, b * z + a * w, b * w - a * z};
+        }
+    }
+
+    // Rotations about the same axis commute and stay on it, 4 multiplications
+    template <details::Arithmetic T, details::Arithmetic U, Axis A>
+    [[nodiscard]] constexpr auto operator*(const AxisQuaternion<T, A>& lhs,
+                                           const AxisQuaternion<U, A>& rhs)
+        -> AxisQuaternion<std::common_type_t<T, U>, A>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V a1 = lhs.V(), b1 = lhs.W();
+        const V a2 = rhs.V(), b2 = rhs.W();
+
+        return AxisQuaternion<V, A>{b1 * a2 + a1 * b2, b1 * b2 - a1 * a2};
+    }
+
+    // Different axes, 4 multiplications
+    template <details::Arithmetic T, details::Arithmetic U, Axis A, Axis B>
+    requires(A != B)
+    [[nodiscard]] constexpr auto operator*(const AxisQuaternion<T, A>& lhs,
+                                           const AxisQuaternion<U, B>& rhs)
+        -> Quaternion<std::common_type_t<T, U>>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V a1 = lhs.V(), b1 = lhs.W();
+        const V a2 = rhs.V(), b2 = rhs.W();
+
+        // e_A * e_B = +/- e_C, positive for cyclic (A, B) pairs
+        constexpr bool cyclic = (A == Axis::X && B == Axis::Y) ||
+                                (A == Axis::Y && B == Axis::Z) || (A == Axis::Z && B == Axis::X);
+        const V c = cyclic ? a1 * a2 : -(a1 * a2);
+
+        V v[3]{};
+        v[static_cast<int>(A)] = a1 * b2;
+        v[static_cast<int>(B)] = b1 * a2;
+        v[3 - static_cast<int>(A) - static_cast<int>(B)] = c;
+
+        return Quaternion<V>{v[0], v[1], v[2], b1 * b2};
+    }
+
+    template <details::Arithmetic T, details::Arithmetic U>
+    requires details::QuaternionConvertible<U, T>
+    constexpr auto operator*=(Quaternion<T>& lhs, const PureQuaternion<U>& rhs) noexcept
+        -> Quaternion<T>&
+    {
+        lhs = static_cast<Quaternion<T>>(lhs * rhs);
+
+        return lhs;
+    }
+
+    template <details::Arithmetic T, details::Arithmetic U, Axis A>
+    requires details::QuaternionConvertible<U, T>
+    constexpr auto operator*=(Quaternion<T>& lhs, const AxisQuaternion<U, A>& rhs) noexcept
+        -> Quaternion<T>&
+    {
+        lhs = static_cast<Quaternion<T>>(lhs * rhs);
+
+        return lhs;
+    }
+
+    // Rotates v by the unit quaternion q, i.e. q * v * q^-1, as
+    // v + 2w(u x v) + 2u x (u x v) with 18 multiplications, three of them by 2, instead of the
+    // 32 of two full products.
+    template <details::Arithmetic T, details::Arithmetic U>
+    [[nodiscard]] constexpr auto Rotate(const Quaternion<T>& q, const PureQuaternion<U>& v) noexcept
+        -> PureQuaternion<std::common_type_t<T, U>>
+    {
+        using V = std::common_type_t<T, U>;
+
+        const V ux = q.X(), uy = q.Y(), uz = q.Z(), w = q.W();
+        const V vx = v.X(), vy = v.Y(), vz = v.Z();
+
+        // t = 2 (u x v)
+        const V tx = 2 * (uy * vz - uz * vy);
+        const V ty = 2 * (uz * vx - ux * vz);
+        const V tz = 2 * (ux * vy - uy * vx);
+
+        return PureQuaternion<V>{vx + w * tx + (uy * tz - uz * ty),
+                                 vy + w * ty + (uz * tx - ux * tz),
+                                 vz + w * tz + (ux * ty - uy * tx)};
+    }
+
+    template <details::Arithmetic T, details::Arithmetic U>
+    [[nodiscard]] constexpr auto operator==(const PureQuaternion<T>& lhs,
+                                            const PureQuaternion<U>& rhs) noexcept -> bool
+    {
+        return lhs.X() == rhs.X() && lhs.Y() == rhs.Y() && lhs.Z() == rhs.Z();
+    }
+
+    template <details::Arithmetic T, details::Arithmetic U, Axis A>
+    [[nodiscard]] constexpr auto operator==(const AxisQuaternion<T, A>& lhs,
+                                            const AxisQuaternion<U, A>& rhs) noexcept -> bool
+    {
+        return lhs.V() == rhs.V() && lhs.W() == rhs.W();
+    }
+} // namespace quaternionlib
+
+#endif // QUATERNIONLIB_QUATERNIONSPARSE_HPP
@@ -0,0 +1,395 @@
+#ifndef QUATERNIONLIB_QUATERNIONSWINGTWIST_HPP
+#define QUATERNIONLIB_QUATERNIONSWINGTWIST_HPP
+
+#include "Quaternion.hpp"
+#include "QuaternionBatch.hpp"
+#include "QuaternionMath.hpp"
+#include "QuaternionParallel.hpp"
+#include "QuaternionSparse.hpp"
+#include "QuaternionView.hpp"
+
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+// Swing-twist decomposition of joint rotations about a twist axis, and joint limits clamped on
+// the quaternions themselves. A rotation q with unit twist axis a splits into q = swing * twist,
+// twist a rotation about a and swing one about an axis perpendicular to a.
+namespace quaternionlib
+{
+    template <std::floating_point T>
+    struct SwingTwist
+    {
+        // w >= 0, so its angle is the smallest one taking a to q a q^-1.
+        Quaternion<T> swing;
+        Quaternion<T> twist;
+    };
+
+    namespace details
+    {
+        // Half-angle sines and cosines of the limits, so clamping needs no trigonometry.
+        template <std::floating_point T>
+        struct JointBounds
+        {
+            T cosHalfCone, sinHalfCone;
+            T sinHalfMinTwist, cosHalfMinTwist;
+            T sinHalfMaxTwist, cosHalfMaxTwist;
+        };
+    } // namespace details
+
+    // Swing within a cone of half-angle cone around the twist axis and twist angle about it
+    // within [minTwist, maxTwist], in radians.
+    template <std::floating_point T>
+    class JointLimits final
+    {
+    public:
+        constexpr JointLimits(T cone, T minTwist, T maxTwist)
+            : _cone(cone), _minTwist(minTwist), _maxTwist(maxTwist)
+        {
+            constexpr T pi = std::numbers::pi_v<T>;
+
+            if (!(cone >= 0 && cone <= pi))
+            {
+                throw std::invalid_argument("Cone angle must be in [0, pi].");
+            }
+
+            if (!(-pi <= minTwist && minTwist <= maxTwist && maxTwist <= pi))
+            {
+                throw std::invalid_argument("Twist limits must satisfy -pi <= min <= max <= pi.");
+            }
+
+            _bounds = details::JointBounds<T>{
+                details::Cos(cone / 2),     details::Sin(cone / 2),
+                details::Sin(minTwist / 2), details::Cos(minTwist / 2),
+                details::Sin(maxTwist / 2), details::Cos(maxTwist / 2)};
+        }
+
+        [[nodiscard]] constexpr auto Cone() const noexcept -> T
+        {
+            return _cone;
+        }
+
+        [[nodiscard]] constexpr auto MinTwist() const noexcept -> T
+        {
+            return _minTwist;
+        }
+
+        [[nodiscard]] constexpr auto MaxTwist() const noexcept -> T
+        {
+            return _maxTwist;
+        }
+
+        [[nodiscard]] constexpr auto Bounds() const noexcept -> const details::JointBounds<T>&
+        {
+            return _bounds;
+        }
+
+    private:
+        T _cone, _minTwist, _maxTwist;
+        details::JointBounds<T> _bounds{};
+    };
+
+    namespace details
+    {
+        // a < b ? ifLess : otherwise, blended by the sign bit of a - b, which is +0 for a == b.
+        // Under -ftrapping-math GCC keeps selects of computed values as branches, and x86 has
+        // 64-bit compare masks only from SSE4.2 on; a shift and a negation vectorize anywhere.
+        template <std::floating_point T>
+        [[nodiscard]] constexpr auto SelectLess(T a, T b, T ifLess, T otherwise) noexcept -> T
+        {
+            constexpr bool narrow = sizeof(T) == sizeof(std::uint32_t);
+
+            if constexpr (std::numeric_limits<T>::is_iec559 &&
+                          (narrow || sizeof(T) == sizeof(std::uint64_t)))
+            {
+                using Bits = std::conditional_t<narrow, std::uint32_t, std::uint64_t>;
+
+                const Bits sign = std::bit_cast<Bits>(a - b) >> (sizeof(Bits) * 8 - 1);
+                const Bits mask = Bits{0} - sign;
+
+                return std::bit_cast<T>((std::bit_cast<Bits>(ifLess) & mask) |
+                                        (std::bit_cast<Bits>(otherwise) & ~mask));
+            }
+            else
+            {
+                return a < b ? ifLess : otherwise;
+            }
+        }
+
+        // 1 / sqrt(squaredNorm), 0 for 0. Fast is the refined reciprocal square root, which has
+        // no errno path, so loops over it vectorize, and is finite for 0 as well.
+        template <MathPolicy Policy, std::floating_point T>
+        [[nodiscard]] constexpr auto InverseNorm(T squaredNorm) noexcept -> T
+        {
+            if constexpr (Policy == MathPolicy::Fast)
+            {
+                return NormalizationScale<MathPolicy::Fast>(squaredNorm);
+            }
+            else
+            {
+                return squaredNorm > 0 ? 1 / Sqrt(squaredNorm) : 0;
+            }
+        }
+
+        // Twist (a p, tw) and swing (sx, sy, sz, sw) of (x, y, z, w), where p is the projection
+        // of (x, y, z) on a. twist is the normalized (a p, w), the identity when that vanishes,
+        // and swing = q * conj(twist), whose w is then |(p, w)| >= 0.
+        template <MathPolicy Policy, std::floating_point T>
+        constexpr auto SplitSwingTwist(T x, T y, T z, T w, T ax, T ay, T az, T& sx, T& sy, T& sz,
+                                       T& sw, T& tx, T& ty, T& tz, T& tw) noexcept -> void
+        {
+            const T p = x * ax + y * ay + z * az;
+            const T squaredNorm = p * p + w * w;
+            const T inverse = InverseNorm<Policy>(squaredNorm);
+            const T twist = p * inverse;
+
+            tx = ax * twist;
+            ty = ay * twist;
+            tz = az * twist;
+            tw = SelectLess(static_cast<T>(0), squaredNorm, w * inverse, static_cast<T>(1));
+
+            HamiltonProduct<Policy>(x, y, z, w, -tx, -ty, -tz, tw, sx, sy, sz, sw);
+        }
+
+        // Clamps (x, y, z, w) in place. Both parts are taken with w >= 0, i.e. with angles in
+        // [-pi, pi], where the half-angle sine of the twist and the half-angle cosine of the
+        // swing are monotonic in the angle. An out-of-range twist is replaced by the bound
+        // nearer around the circle, the one whose half-angle dot product with it is larger in
+        // magnitude, so -pi and pi count as neighbours; a swing outside the cone is scaled onto
+        // it along its own axis. Rotations within the limits come back unchanged up to
+        // rounding, with their sign.
+        template <MathPolicy Policy, std::floating_point T>
+        constexpr auto ClampJoint(T& x, T& y, T& z, T& w, T ax, T ay, T az,
+                                  const JointBounds<T>& bounds) noexcept -> void
+        {
+            const T sign = CopySign(static_cast<T>(1), w);
+
+            T sx{}, sy{}, sz{}, sw{}, tx{}, ty{}, tz{}, tw{};
+            SplitSwingTwist<Policy>(sign * x, sign * y, sign * z, sign * w, ax, ay, az, sx, sy, sz,
+                                    sw, tx, ty, tz, tw);
+
+            const T twist = tx * ax + ty * ay + tz * az;
+            const T toMax = Abs(twist * bounds.sinHalfMaxTwist + tw * bounds.cosHalfMaxTwist);
+            const T toMin = Abs(twist * bounds.sinHalfMinTwist + tw * bounds.cosHalfMinTwist);
+            const T sinBound =
+                SelectLess(toMax, toMin, bounds.sinHalfMinTwist, bounds.sinHalfMaxTwist);
+            const T cosBound =
+                SelectLess(toMax, toMin, bounds.cosHalfMinTwist, bounds.cosHalfMaxTwist);
+
+            T clamped = SelectLess(bounds.sinHalfMaxTwist, twist, sinBound, twist);
+            clamped = SelectLess(twist, bounds.sinHalfMinTwist, sinBound, clamped);
+            tw = SelectLess(bounds.sinHalfMaxTwist, twist, cosBound, tw);
+            tw = SelectLess(twist, bounds.sinHalfMinTwist, cosBound, tw);
+
+            const T coneScale =
+                bounds.sinHalfCone * InverseNorm<Policy>(sx * sx + sy * sy + sz * sz);
+            const T scale = SelectLess(sw, bounds.cosHalfCone, coneScale, static_cast<T>(1));
+
+            sx *= scale;
+            sy *= scale;
+            sz *= scale;
+            sw = SelectLess(sw, bounds.cosHalfCone, bounds.cosHalfCone, sw);
+
+            HamiltonProduct<Policy>(sx, sy, sz, sw, ax * clamped, ay * clamped, az * clamped, tw, x,
+                                    y, z, w);
+
+            x *= sign;
+            y *= sign;
+            z *= sign;
+            w *= sign;
+        }
+
+        template <std::floating_point T, typename Source, typename Target>
+        auto DecomposeSwingTwist(Source in, const PureQuaternion<T>& axis, Target swings,
+                                 Target twists, std::size_t threads) -> void
+        {
+            assert(BatchSize(in) == BatchSize(swings) && BatchSize(in) == BatchSize(twists));
+
+            ForEachBlock(BatchSize(in), threads, BATCH_MIN_CHUNK,
+                         [&](std::size_t offset, std::size_t count)
+                         {
+                             StagedBlock<T> swing{BatchSlice(in, offset, count)};
+                             StagedBlock<T> twist{count};
+
+                             const T ax = axis.X(), ay = axis.Y(), az = axis.Z();
+
+                             for (std::size_t i = 0; i < count; ++i)
+                             {
+                                 SplitSwingTwist<MathPolicy::Fast>(
+                                     swing.x[i], swing.y[i], swing.z[i], swing.w[i], ax, ay, az,
+                                     swing.x[i], swing.y[i], swing.z[i], swing.w[i], twist.x[i],
+                                     twist.y[i], twist.z[i], twist.w[i]);
+                             }
+
+                             swing.StoreTo(BatchSlice(swings, offset, count));
+                             twist.StoreTo(BatchSlice(twists, offset, count));
+                         });
+        }
+
+        template <std::floating_point T, typename Source, typename Target>
+        auto ClampJoints(Source in, const PureQuaternion<T>& axis, const JointLimits<T>& limits,
+                         Target out, std::size_t threads) -> void
+        {
+            assert(BatchSize(in) == BatchSize(out));
+
+            ForEachBlock(BatchSize(out), threads, BATCH_MIN_CHUNK,
+                         [&](std::size_t offset, std::size_t count)
+                         {
+                             StagedBlock<T> block{BatchSlice(in, offset, count)};
+
+                             const T ax = axis.X(), ay = axis.Y(), az = axis.Z();
+                             const JointBounds<T> bounds = limits.Bounds();
+
+                             for (std::size_t i = 0; i < count; ++i)
+                             {
+                                 ClampJoint<MathPolicy::Fast>(block.x[i], block.y[i], block.z[i],
+                                                              block.w[i], ax, ay, az, bounds);
+                             }
+
+                             block.StoreTo(BatchSlice(out, offset, count));
+                         });
+        }
+    } // namespace details
+
+    // q = swing * twist for a unit quaternion q and unit twist axis. When q rotates a by half a
+    // turn the twist is undefined and taken as the identity.
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto DecomposeSwingTwist(const Quaternion<T>& q,
+                                                     const PureQuaternion<T>& axis) noexcept
+        -> SwingTwist<T>
+    {
+        T sx{}, sy{}, sz{}, sw{}, tx{}, ty{}, tz{}, tw{};
+
+        details::SplitSwingTwist<MathPolicy::Deterministic>(q.X(), q.Y(), q.Z(), q.W(), axis.X(),
+                                                            axis.Y(), axis.Z(), sx, sy, sz, sw,
+                                                            tx, ty, tz, tw);
+
+        return SwingTwist<T>{Quaternion<T>{sx, sy, sz, sw}, Quaternion<T>{tx, ty, tz, tw}};
+    }
+
+    // Nearest rotation within the limits in swing and twist separately, with twist angles
+    // compared around the circle.
+    template <std::floating_point T>
+    [[nodiscard]] constexpr auto ClampJoint(const Quaternion<T>& q, const PureQuaternion<T>& axis,
+                                            const JointLimits<T>& limits) noexcept -> Quaternion<T>
+    {
+        T x = q.X(), y = q.Y(), z = q.Z(), w = q.W();
+
+        details::ClampJoint<MathPolicy::Deterministic>(x, y, z, w, axis.X(), axis.Y(), axis.Z(),
+                                                       limits.Bounds());
+
+        return Quaternion<T>{x, y, z, w};
+    }
+
+    // Batched forms, one twist axis for all. They use MathPolicy::Fast and agree with the
+    // scalar forms to within a few ulp.
+    template <std::floating_point T>
+    auto DecomposeSwingTwist(QuaternionSoASpan<const T> in, const PureQuaternion<T>& axis,
+                             QuaternionSoASpan<T> swings, QuaternionSoASpan<T> twists,
+                             std::size_t threads = 1) -> void
+    {
+        details::DecomposeSwingTwist(in, axis, swings, twists, threads);
+    }
+
+    template <std::floating_point T>
+    auto DecomposeSwingTwist(std::span<const Quaternion<T>> in, const PureQuaternion<T>& axis,
+                             std::span<Quaternion<T>> swings, std::span<Quaternion<T>> twists,
+                             std::size_t threads = 1) -> void
+    {
+        details::DecomposeSwingTwist(in, axis, swings, twists, threads);
+    }
+
+    template <details::MaybeConstArithmetic U, ComponentOrder InOrder, std::size_t InStride,
+              std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    requires std::is_same_v<std::remove_const_t<U>, T>
+    auto DecomposeSwingTwist(QuaternionStridedView<U, InOrder, InStride> in,
+                             const PureQuaternion<T>& axis,
+                             QuaternionStridedView<T, Order, Stride> swings,
+                             QuaternionStridedView<T, Order, Stride> twists,
+                             std::size_t threads = 1) -> void
+    {
+        details::DecomposeSwingTwist(in, axis, swings, twists, threads);
+    }
+
+    // out[i] = ClampJoint(in[i], axis, limits), in place when in and out are the same array.
+    template <std::floating_point T>
+    auto ClampJoints(QuaternionSoASpan<const T> in, const PureQuaternion<T>& axis,
+                     const JointLimits<T>& limits, QuaternionSoASpan<T> out,
+                     std::size_t threads = 1) -> void
+    {
+        details::ClampJoints(in, axis, limits, out, threads);
+    }
+
+    template <std::floating_point T>
+    auto ClampJoints(QuaternionSoASpan<T> rotations, const PureQuaternion<T>& axis,
+                     const JointLimits<T>& limits, std::size_t threads = 1) -> void
+    {
+        details::ClampJoints(rotations, axis, limits, rotations, threads);
+    }
+
+    template <std::floating_point T>
+    auto ClampJoints(std::span<const Quaternion<T>> in, const PureQuaternion<T>& axis,
+                     const JointLimits<T>& limits, std::span<Quaternion<T>> out,
+                     std::size_t threads = 1) -> void
+    {
+        details::ClampJoints(in, axis, limits, out, threads);
+    }
+
+    template <std::floating_point T>
+    auto ClampJoints(std::span<Quaternion<T>> rotations, const PureQuaternion<T>& axis,
+                     const JointLimits<T>& limits, std::size_t threads = 1) -> void
+    {
+        details::ClampJoints(std::span<const Quaternion<T>>{rotations}, axis, limits, rotations,
+                             threads);
+    }
+
+    template <std::floating_point T, ComponentOrder Order, std::size_t Stride>
+    auto ClampJoints(QuaternionStridedView<T, Order, Stride> rotations,
+                     const PureQuaternion<T>& axis, const JointLimits<T>& limits,
+                     std::size_t threads = 1) -> void
+    {
+        details::ClampJoints(rotations, axis, limits, rotations, threads);
+    }
+} // namespace quaternionlib
+
+#define QUATERNIONLIB_INSTANTIATE_SWING_TWIST(EXTERN, T)                                           \
+    EXTERN template class JointLimits<T>;                                                          \
+    EXTERN template auto DecomposeSwingTwist<T>(const Quaternion<T>&,                              \
+                                                const PureQuaternion<T>&) noexcept                 \
+        -> SwingTwist<T>;                                                                          \
+    EXTERN template auto ClampJoint<T>(const Quaternion<T>&, const PureQuaternion<T>&,             \
+                                       const JointLimits<T>&) noexcept -> Quaternion<T>;           \
+    EXTERN template auto DecomposeSwingTwist<T>(QuaternionSoASpan<const T>,                        \
+                                                const PureQuaternion<T>&, QuaternionSoASpan<T>,    \
+                                                QuaternionSoASpan<T>, std::size_t) -> void;        \
+    EXTERN template auto DecomposeSwingTwist<T>(std::span<const Quaternion<T>>,                    \
+                                                const PureQuaternion<T>&,                          \
+                                                std::span<Quaternion<T>>,                          \
+                                                std::span<Quaternion<T>>, std::size_t) -> void;    \
+    EXTERN template auto ClampJoints<T>(QuaternionSoASpan<const T>, const PureQuaternion<T>&,      \
+                                        const JointLimits<T>&, QuaternionSoASpan<T>, std::size_t)  \
+        -> void;                                                                                   \
+    EXTERN template auto ClampJoints<T>(QuaternionSoASpan<T>, const PureQuaternion<T>&,            \
+                                        const JointLimits<T>&, std::size_t) -> void;               \
+    EXTERN template auto ClampJoints<T>(std::span<const Quaternion<T>>, const PureQuaternion<T>&,  \
+                                        const JointLimits<T>&, std::span<Quaternion<T>>,           \
+                                        std::size_t) -> void;                                      \
+    EXTERN template auto ClampJoints<T>(std::span<Quaternion<T>>, const PureQuaternion<T>&,        \
+                                        const JointLimits<T>&, std::size_t) -> void;
+
+#if defined(QUATERNIONLIB_EXTERN_TEMPLATES)
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_SWING_TWIST(extern, float)
+    QUATERNIONLIB_INSTANTIATE_SWING_TWIST(extern, double)
+} // namespace quaternionlib
+#endif
+
+#endif // QUATERNIONLIB_QUATERNIONSWINGTWIST_HPP
@@ -0,0 +1,204 @@
+#ifndef QUATERNIONLIB_QUATERNIONVIEW_HPP
+#define QUATERNIONLIB_QUATERNIONVIEW_HPP
+
+#include "Quaternion.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#if defined(__has_include)
+#if __has_include(<mdspan>)
+#include <array>
+#include <mdspan>
+#endif
+#endif
+
+// Non-owning views presenting quaternions stored in foreign buffers, modeled on std::mdspan's
+// layout mappings: a component order policy and a static or dynamic record stride.
+namespace quaternionlib
+{
+    namespace details
+    {
+        template <typename T>
+        concept MaybeConstArithmetic = Arithmetic<std::remove_const_t<T>>;
+    } // namespace details
+
+    // Position of the scalar part within the four consecutive components of a record.
+    enum class ComponentOrder
+    {
+        XYZW,
+        WXYZ
+    };
+
+    // Quaternions whose four components are consecutive, with records Stride elements of T
+    // apart: packed arrays (Stride 4), strided structs and interleaved pose records. With
+    // Stride = std::dynamic_extent the stride is given at run time. T may be const-qualified.
+    template <details::MaybeConstArithmetic T, ComponentOrder Order = ComponentOrder::XYZW,
+              std::size_t Stride = 4>
+    class QuaternionStridedView final
+    {
+    public:
+        using value_type = std::remove_const_t<T>;
+
+        static constexpr ComponentOrder order = Order;
+        static constexpr std::size_t static_stride = Stride;
+
+        constexpr QuaternionStridedView() noexcept = default;
+
+        // data points at the first component of the first record.
+        constexpr QuaternionStridedView(T* data, std::size_t size) noexcept
+        requires(Stride != std::dynamic_extent)
+            : _data(data), _size(size), _stride(Stride)
+        {
+            static_assert(Stride >= 4);
+        }
+
+        constexpr QuaternionStridedView(T* data, std::size_t size, std::size_t stride) noexcept
+        requires(Stride == std::dynamic_extent)
+            : _data(data), _size(size), _stride(stride)
+        {
+            assert(stride >= 4);
+        }
+
+        template <details::Arithmetic U>
+        requires std::is_same_v<const U, T>
+        constexpr QuaternionStridedView(const QuaternionStridedView<U, Order, Stride>& other) noexcept
+            : _data(other.Data()), _size(other.Size()), _stride(other.RecordStride())
+        {
+        }
+
+        [[nodiscard]] constexpr auto Data() const noexcept -> T*
+        {
+            return _data;
+        }
+
+        [[nodiscard]] constexpr auto Size() const noexcept -> std::size_t
+        {
+            return _size;
+        }
+
+        [[nodiscard]] constexpr auto RecordStride() const noexcept -> std::size_t
+        {
+            if constexpr (Stride != std::dynamic_extent)
+            {
+                return Stride;
+            }
+            else
+            {
+                return _stride;
+            }
+        }
+
+        [[nodiscard]] constexpr auto X(std::size_t i) const noexcept -> T&
+        {
+            return Component(i, Order == ComponentOrder::XYZW ? 0 : 1);
+        }
+
+        [[nodiscard]] constexpr auto Y(std::size_t i) const noexcept -> T&
+        {
+            return Component(i, Order == ComponentOrder::XYZW ? 1 : 2);
+        }
+
+        [[nodiscard]] constexpr auto Z(std::size_t i) const noexcept -> T&
+        {
+            return Component(i, Order == ComponentOrder::XYZW ? 2 : 3);
+        }
+
+        [[nodiscard]] constexpr auto W(std::size_t i) const noexcept -> T&
+        {
+            return Component(i, Order == ComponentOrder::XYZW ? 3 : 0);
+        }
+
+        [[nodiscard]] constexpr auto Load(std::size_t i) const noexcept -> Quaternion<value_type>
+        {
+            return Quaternion<value_type>{X(i), Y(i), Z(i), W(i)};
+        }
+
+        constexpr auto Store(std::size_t i, const Quaternion<value_type>& q) const noexcept -> void
+        requires(!std::is_const_v<T>)
+        {
+            X(i) = q.X();
+            Y(i) = q.Y();
+            Z(i) = q.Z();
+            W(i) = q.W();
+        }
+
+        [[nodiscard]] constexpr auto Subspan(std::size_t offset, std::size_t count) const noexcept
+            -> QuaternionStridedView
+        {
+            assert(offset + count <= _size);
+
+            QuaternionStridedView view{*this};
+            view._data = _data + offset * RecordStride();
+            view._size = count;
+
+            return view;
+        }
+
+#if defined(__cpp_lib_mdspan)
+        // The same buffer as a Size() x 4 matrix of components in storage order.
+        [[nodiscard]] auto ToMdspan() const
+        {
+            using Extents = std::extents<std::size_t, std::dynamic_extent, 4>;
+
+            return std::mdspan<T, Extents, std::layout_stride>{
+                _data, std::layout_stride::mapping<Extents>{
+                           Extents{_size}, std::array<std::size_t, 2>{RecordStride(), 1}}};
+        }
+#endif
+
+    private:
+        [[nodiscard]] constexpr auto Component(std::size_t i, std::size_t k) const noexcept -> T&
+        {
+            assert(i < _size);
+
+            return _data[i * RecordStride() + k];
+        }
+
+        T* _data = nullptr;
+        std::size_t _size = 0;
+        std::size_t _stride = Stride;
+    };
+
+    template <details::MaybeConstArithmetic T, ComponentOrder Order = ComponentOrder::XYZW>
+    using QuaternionRecordView = QuaternionStridedView<T, Order, std::dynamic_extent>;
+
+    // View over a T[4] member of each record, e.g. ViewMember<ComponentOrder::WXYZ>(poses,
+    // &Pose::orientation).
+    template <ComponentOrder Order, typename Record, details::Arithmetic T>
+    [[nodiscard]] auto ViewMember(std::span<Record> records,
+                                  T (std::remove_const_t<Record>::*member)[4]) noexcept
+    {
+        static_assert(sizeof(Record) % sizeof(T) == 0,
+                      "Record size must be a multiple of the component size.");
+
+        using Element = std::conditional_t<std::is_const_v<Record>, const T, T>;
+
+        if (records.empty())
+        {
+            return QuaternionRecordView<Element, Order>{nullptr, 0, sizeof(Record) / sizeof(T)};
+        }
+
+        return QuaternionRecordView<Element, Order>{&(records.front().*member)[0], records.size(),
+                                                    sizeof(Record) / sizeof(T)};
+    }
+
+#if defined(__cpp_lib_mdspan)
+    // Size() x 4 component matrix whose columns are contiguous, e.g. std::layout_right or
+    // std::layout_stride over records.
+    template <ComponentOrder Order = ComponentOrder::XYZW, details::MaybeConstArithmetic T,
+              typename Extents, typename Layout>
+    requires(Extents::rank() == 2)
+    [[nodiscard]] auto ViewOf(std::mdspan<T, Extents, Layout> components)
+        -> QuaternionRecordView<T, Order>
+    {
+        assert(components.extent(1) == 4 && components.stride(1) == 1);
+
+        return {components.data_handle(), components.extent(0), components.stride(0)};
+    }
+#endif
+} // namespace quaternionlib
+
+#endif // QUATERNIONLIB_QUATERNIONVIEW_HPP
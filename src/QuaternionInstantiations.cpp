@@ -0,0 +1,55 @@
+#include <AttitudeFilter.hpp>
+#include <AttitudeIntegrator.hpp>
+#include <AttitudeSimplifier.hpp>
+#include <Quaternion.hpp>
+#include <QuaternionAccumulator.hpp>
+#include <QuaternionBatch.hpp>
+#include <QuaternionDistance.hpp>
+#include <QuaternionFormat.hpp>
+#include <QuaternionParse.hpp>
+#include <QuaternionProduct.hpp>
+#include <QuaternionRandom.hpp>
+#include <QuaternionRing.hpp>
+#include <QuaternionSwingTwist.hpp>
+
+namespace quaternionlib
+{
+    QUATERNIONLIB_INSTANTIATE_QUATERNION(, float)
+    QUATERNIONLIB_INSTANTIATE_QUATERNION(, double)
+
+    QUATERNIONLIB_INSTANTIATE_BATCH(, float)
+    QUATERNIONLIB_INSTANTIATE_BATCH(, double)
+
+    QUATERNIONLIB_INSTANTIATE_PRODUCT(, float)
+    QUATERNIONLIB_INSTANTIATE_PRODUCT(, double)
+
+    QUATERNIONLIB_INSTANTIATE_FORMAT(, float)
+    QUATERNIONLIB_INSTANTIATE_FORMAT(, double)
+
+    QUATERNIONLIB_INSTANTIATE_PARSE(, float)
+    QUATERNIONLIB_INSTANTIATE_PARSE(, double)
+
+    QUATERNIONLIB_INSTANTIATE_INTEGRATOR(, float)
+    QUATERNIONLIB_INSTANTIATE_INTEGRATOR(, double)
+
+    QUATERNIONLIB_INSTANTIATE_FILTER(, float)
+    QUATERNIONLIB_INSTANTIATE_FILTER(, double)
+
+    QUATERNIONLIB_INSTANTIATE_RANDOM(, float)
+    QUATERNIONLIB_INSTANTIATE_RANDOM(, double)
+
+    QUATERNIONLIB_INSTANTIATE_RING(, float)
+    QUATERNIONLIB_INSTANTIATE_RING(, double)
+
+    QUATERNIONLIB_INSTANTIATE_DISTANCE(, float)
+    QUATERNIONLIB_INSTANTIATE_DISTANCE(, double)
+
+    QUATERNIONLIB_INSTANTIATE_SIMPLIFIER(, float)
+    QUATERNIONLIB_INSTANTIATE_SIMPLIFIER(, double)
+
+    QUATERNIONLIB_INSTANTIATE_SWING_TWIST(, float)
+    QUATERNIONLIB_INSTANTIATE_SWING_TWIST(, double)
+
+    QUATERNIONLIB_INSTANTIATE_ACCUMULATOR(, float)
+    QUATERNIONLIB_INSTANTIATE_ACCUMULATOR(, double)
+} // namespace quaternionlib
@@ -0,0 +1,139 @@
+module;
+
+#include <AttitudeFilter.hpp>
+#include <AttitudeIntegrator.hpp>
+#include <AttitudeSimplifier.hpp>
+#include <Quaternion.hpp>
+#include <QuaternionAccumulator.hpp>
+#include <QuaternionBatch.hpp>
+#include <QuaternionDistance.hpp>
+#include <QuaternionFormat.hpp>
+#include <QuaternionMath.hpp>
+#include <QuaternionParse.hpp>
+#include <QuaternionPipeline.hpp>
+#include <QuaternionProduct.hpp>
+#include <QuaternionRandom.hpp>
+#include <QuaternionRing.hpp>
+#include <QuaternionSparse.hpp>
+#include <QuaternionSwingTwist.hpp>
+#include <QuaternionView.hpp>
+
+export module quaternionlib;
+
+// The headers are parsed once in the global module fragment above; importers see only the
+// public names below. std::formatter specializations stay reachable without being exported.
+export namespace quaternionlib
+{
+    using quaternionlib::EPSILON;
+    using quaternionlib::Quaternion;
+    using quaternionlib::IsApproxEqual;
+    using quaternionlib::operator<<;
+    using quaternionlib::operator==;
+    using quaternionlib::operator!=;
+    using quaternionlib::operator+;
+    using quaternionlib::operator-;
+    using quaternionlib::operator*;
+    using quaternionlib::operator/;
+
+    using quaternionlib::MathPolicy;
+    using quaternionlib::Multiply;
+    using quaternionlib::Norm;
+    using quaternionlib::Normalize;
+    using quaternionlib::Normalized;
+    using quaternionlib::SquaredNorm;
+
+    using quaternionlib::Axis;
+    using quaternionlib::AxisQuaternion;
+    using quaternionlib::PureQuaternion;
+    using quaternionlib::Rotate;
+    using quaternionlib::XAxisQuaternion;
+    using quaternionlib::YAxisQuaternion;
+    using quaternionlib::ZAxisQuaternion;
+
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::QuaternionSoASpan;
+    using quaternionlib::Vector3SoASpan;
+
+    using quaternionlib::LeftMultiplyAll;
+    using quaternionlib::RightMultiplyAll;
+
+    using quaternionlib::ComponentOrder;
+    using quaternionlib::QuaternionRecordView;
+    using quaternionlib::QuaternionStridedView;
+    using quaternionlib::ViewMember;
+#if defined(__cpp_lib_mdspan)
+    using quaternionlib::ViewOf;
+#endif
+
+    using quaternionlib::MaxTextSize;
+    using quaternionlib::TextFormat;
+    using quaternionlib::TextLayout;
+    using quaternionlib::ToChars;
+    using quaternionlib::WriteCsv;
+    using quaternionlib::WriteJson;
+    using quaternionlib::WriteText;
+
+    using quaternionlib::FromChars;
+    using quaternionlib::ParseText;
+    using quaternionlib::ParseTextParallel;
+    using quaternionlib::QuaternionStreamParser;
+#if defined(QUATERNIONLIB_HAS_MMAP)
+    using quaternionlib::MappedFile;
+    using quaternionlib::ParseFile;
+#endif
+
+    using quaternionlib::IntegrateExponential;
+    using quaternionlib::IntegrateRK4;
+    using quaternionlib::MadgwickFilterBank;
+    using quaternionlib::MahonyFilterBank;
+
+    using quaternionlib::RandomRotationGenerator;
+
+    using quaternionlib::StampedQuaternion;
+#if defined(QUATERNIONLIB_HAS_SHM)
+    using quaternionlib::RingRead;
+    using quaternionlib::SharedRingReader;
+    using quaternionlib::SharedRingWriter;
+#endif
+
+    using quaternionlib::AngularDistance;
+    using quaternionlib::Distance;
+    using quaternionlib::DistanceMatrix;
+    using quaternionlib::DistanceMetric;
+    using quaternionlib::Distances;
+    using quaternionlib::Dot;
+    using quaternionlib::InnerProductDistance;
+    using quaternionlib::Nearest;
+
+    using quaternionlib::Exp;
+    using quaternionlib::Log;
+    using quaternionlib::Slerp;
+
+    using quaternionlib::AttitudeSimplifier;
+    using quaternionlib::Keyframe;
+    using quaternionlib::Reconstruct;
+
+    using quaternionlib::Generator;
+    using quaternionlib::QuaternionChunk;
+
+    using quaternionlib::ClampJoint;
+    using quaternionlib::ClampJoints;
+    using quaternionlib::DecomposeSwingTwist;
+    using quaternionlib::JointLimits;
+    using quaternionlib::SwingTwist;
+
+    using quaternionlib::RotationAccumulator;
+} // namespace quaternionlib
+
+export namespace quaternionlib::pipeline
+{
+    using quaternionlib::pipeline::Chunks;
+    using quaternionlib::pipeline::Downsample;
+    using quaternionlib::pipeline::Map;
+    using quaternionlib::pipeline::Normalize;
+    using quaternionlib::pipeline::Parse;
+    using quaternionlib::pipeline::ReadText;
+    using quaternionlib::pipeline::Threaded;
+    using quaternionlib::pipeline::Upsample;
+    using quaternionlib::pipeline::Write;
+} // namespace quaternionlib::pipeline
@@ -0,0 +1,26 @@
+#ifndef QUATERNIONLIB_TEST_RANDOMROTATIONS_HPP
+#define QUATERNIONLIB_TEST_RANDOMROTATIONS_HPP
+
+#include <Quaternion.hpp>
+#include <QuaternionRandom.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Fixtures shared by the tests and benchmarks.
+namespace quaternionlib::test
+{
+    // count uniformly distributed unit quaternions, the same for the same seed.
+    template <std::floating_point T = double>
+    auto RandomRotations(std::size_t count, std::uint64_t seed) -> std::vector<Quaternion<T>>
+    {
+        std::vector<Quaternion<T>> out(count);
+        RandomRotationGenerator<T>{seed}.Generate(out);
+
+        return out;
+    }
+} // namespace quaternionlib::test
+
+#endif // QUATERNIONLIB_TEST_RANDOMROTATIONS_HPP
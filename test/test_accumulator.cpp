@@ -0,0 +1,147 @@
+#include <AttitudeIntegrator.hpp>
+#include <QuaternionAccumulator.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace
+{
+    using quaternionlib::Quaternion;
+    using quaternionlib::RotationAccumulator;
+
+    constexpr double EPS = std::numeric_limits<double>::epsilon();
+
+    // Distance between the directions of q and of the rotation by angle about (x, y, z),
+    // evaluated in long double: about half the angle between them.
+    auto DirectionError(const Quaternion<double>& q, long double x, long double y, long double z,
+                        long double angle) -> long double
+    {
+        const long double norm = std::sqrt(static_cast<long double>(q.SquaredNorm()));
+        const long double s = std::sin(angle / 2);
+
+        return std::hypot(std::hypot(q.X() / norm - x * s, q.Y() / norm - y * s),
+                          std::hypot(q.Z() / norm - z * s, q.W() / norm - std::cos(angle / 2)));
+    }
+} // namespace
+
+TEST_CASE("Rotation accumulator")
+{
+    SECTION("A step matches the Hamilton product")
+    {
+        const auto q = Quaternion<double>{0.3, -1.2, 0.7, 2.0}.Normalized();
+        const auto r = Quaternion<double>{-0.5, 0.1, 0.4, 1.0}.Normalized();
+
+        RotationAccumulator<double> accumulator{q};
+        accumulator *= r;
+
+        const auto product = q * r;
+
+        REQUIRE(std::abs(accumulator.Value().X() - product.X()) <= 4 * EPS);
+        REQUIRE(std::abs(accumulator.Value().Y() - product.Y()) <= 4 * EPS);
+        REQUIRE(std::abs(accumulator.Value().Z() - product.Z()) <= 4 * EPS);
+        REQUIRE(std::abs(accumulator.Value().W() - product.W()) <= 4 * EPS);
+        REQUIRE(RotationAccumulator<double>{}.Value() == Quaternion<double>{0.0, 0.0, 0.0, 1.0});
+    }
+
+    SECTION("Long chains neither drift nor lose their norm")
+    {
+        constexpr long count = 200'000;
+
+        // A fixed step about a fixed axis; its powers stay on the axis of the rounded step.
+        const auto step = Quaternion<double>{1e-3, -2e-3, 2e-3, 1.0}.Normalized();
+        const long double vector =
+            std::hypot(std::hypot(static_cast<long double>(step.X()), step.Y()), step.Z());
+        const long double angle = 2 * std::atan2(vector, static_cast<long double>(step.W()));
+
+        RotationAccumulator<double> accumulator;
+        Quaternion<double> plain{0.0, 0.0, 0.0, 1.0};
+
+        for (long i = 0; i < count; ++i)
+        {
+            accumulator *= step;
+            plain *= step;
+        }
+
+        const long double total = angle * count;
+        const auto error = [&](const Quaternion<double>& q)
+        {
+            return DirectionError(q, step.X() / vector, step.Y() / vector, step.Z() / vector,
+                                  total);
+        };
+
+        // Rounding of the final value and of the reference, against ~1e-11 for operator*=.
+        REQUIRE(error(accumulator.Value()) < 1e-15);
+        REQUIRE(error(accumulator.Value()) * 100 < error(plain));
+        REQUIRE(std::abs(accumulator.Value().Norm() - 1) <= EPS);
+    }
+
+    SECTION("Steps off the unit sphere are projected onto it")
+    {
+        const Quaternion<double> step{0.0, 0.0, std::sin(0.01), std::cos(0.01) * (1 + 1e-12)};
+
+        RotationAccumulator<double> accumulator;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            accumulator *= step;
+        }
+
+        REQUIRE(std::abs(accumulator.Value().Norm() - 1) <= 2 * EPS);
+    }
+
+    SECTION("Renormalization in double length")
+    {
+        RotationAccumulator<double> accumulator{Quaternion<double>{1.0, 2.0, 2.0, 4.0}};
+        accumulator.Renormalize();
+
+        const auto& value = accumulator.Value();
+        const auto& low = accumulator.Compensation();
+
+        REQUIRE(value == Quaternion<double>{0.2, 0.4, 0.4, 0.8});
+
+        // (value + low) * 5 is (1, 2, 2, 4) to double-length precision.
+        REQUIRE(std::abs((static_cast<long double>(value.X()) + low.X()) * 5 - 1) < 1e-18);
+        REQUIRE(std::abs((static_cast<long double>(value.W()) + low.W()) * 5 - 4) < 1e-18);
+        REQUIRE(std::abs(low.Y()) <= std::abs(value.Y()) * EPS);
+    }
+
+    SECTION("Integrators compose into the accumulator")
+    {
+        RotationAccumulator<double> accumulator;
+        Quaternion<double> plain{0.0, 0.0, 0.0, 1.0};
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            quaternionlib::IntegrateExponential(accumulator, 0.3, -0.2, 0.5, 1e-3);
+            quaternionlib::IntegrateExponential(plain, 0.3, -0.2, 0.5, 1e-3);
+        }
+
+        REQUIRE(std::abs(accumulator.Value().X() - plain.X()) <= 1e-13);
+        REQUIRE(std::abs(accumulator.Value().W() - plain.W()) <= 1e-13);
+    }
+
+    SECTION("Constant evaluation")
+    {
+        constexpr auto quarter = []
+        {
+            // 90 steps of one degree about z.
+            constexpr double half = std::numbers::pi / 360;
+            const Quaternion<double> step{0.0, 0.0, quaternionlib::details::Sin(half),
+                                          quaternionlib::details::Cos(half)};
+
+            RotationAccumulator<double> accumulator;
+
+            for (int i = 0; i < 90; ++i)
+            {
+                accumulator *= step;
+            }
+
+            return accumulator.Value();
+        }();
+
+        static_assert(quarter.X() == 0.0 && quarter.Z() > 0.7 && quarter.W() > 0.7);
+        REQUIRE(std::abs(quarter.Z() - std::sqrt(0.5)) <= EPS);
+        REQUIRE(std::abs(quarter.W() - std::sqrt(0.5)) <= EPS);
+    }
+}
@@ -0,0 +1,232 @@
+#include <QuaternionDistance.hpp>
+#include <QuaternionMath.hpp>
+#include <QuaternionSparse.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+
+namespace
+{
+    using quaternionlib::Axis;
+    using quaternionlib::AxisQuaternion;
+    using quaternionlib::MathPolicy;
+    using quaternionlib::PureQuaternion;
+    using quaternionlib::Quaternion;
+
+    constexpr std::size_t COUNT = 512;
+
+    // Positive doubles with random bits across the whole exponent range, subnormals included.
+    constexpr auto Inputs() -> std::array<double, COUNT>
+    {
+        std::array<double, COUNT> out{};
+        std::uint64_t state = 0x9E3779B97F4A7C15;
+
+        for (auto& value : out)
+        {
+            state = state * 6364136223846793005 + 1442695040888963407;
+            value = std::bit_cast<double>((state >> 1) % 0x7FF0000000000000);
+        }
+
+        return out;
+    }
+
+    constexpr auto INPUTS = Inputs();
+
+    template <typename F>
+    constexpr auto Tabulate(F f) -> std::array<double, COUNT>
+    {
+        std::array<double, COUNT> out{};
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            out[i] = f(i);
+        }
+
+        return out;
+    }
+
+    auto WithinUlps(double value, double expected, double ulps) -> bool
+    {
+        const double ulp = std::max(std::abs(expected) * std::numeric_limits<double>::epsilon(),
+                                    std::numeric_limits<double>::denorm_min());
+
+        return std::abs(value - expected) <= ulps * ulp;
+    }
+
+    // Rotations about z in 10 degree steps.
+    constexpr auto RotationTable() -> std::array<Quaternion<double>, 36>
+    {
+        std::array<Quaternion<double>, 36> table{};
+
+        for (std::size_t k = 0; k < table.size(); ++k)
+        {
+            const auto q = AxisQuaternion<double, Axis::Z>::FromAngle(
+                static_cast<double>(k) * std::numbers::pi / 18);
+
+            table[k] = Quaternion<double>{q.X(), q.Y(), q.Z(), q.W()};
+        }
+
+        return table;
+    }
+} // namespace
+
+TEST_CASE("Compile-time norms")
+{
+    constexpr Quaternion<double> q{1.0, 2.0, 2.0, 4.0};
+
+    static_assert(q.Norm() == 5.0);
+    static_assert(q.Normalized() == Quaternion<double>{0.2, 0.4, 0.4, 0.8});
+    static_assert(q.Normalized().IsNormalized());
+    static_assert(!q.IsNormalized());
+    static_assert(Quaternion<int>{1, 1, 1, 1}.Norm() == 2);
+    static_assert(PureQuaternion<float>{3.0f, 0.0f, 4.0f}.Norm() == 5.0f);
+    static_assert(quaternionlib::Norm<MathPolicy::Deterministic>(q) == 5.0);
+
+    constexpr auto normalized = []
+    {
+        Quaternion<double> copy{1.0, 2.0, 2.0, 4.0};
+        copy.Normalize();
+
+        return copy;
+    }();
+
+    static_assert(normalized == q.Normalized());
+
+    SECTION("sqrt matches std::sqrt exactly")
+    {
+        constexpr auto roots = Tabulate([](std::size_t i)
+                                        { return quaternionlib::details::Sqrt(INPUTS[i]); });
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            REQUIRE(roots[i] == std::sqrt(INPUTS[i]));
+        }
+
+        constexpr auto floatRoots = []
+        {
+            std::array<float, COUNT> out{};
+
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = quaternionlib::details::Sqrt(static_cast<float>(i) * 0.37f + 1e-30f);
+            }
+
+            return out;
+        }();
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            REQUIRE(floatRoots[i] == std::sqrt(static_cast<float>(i) * 0.37f + 1e-30f));
+        }
+    }
+
+    SECTION("Deterministic normalization matches run time")
+    {
+        constexpr auto normalizedAtCompileTime = []
+        {
+            std::array<Quaternion<double>, COUNT> out{};
+
+            for (std::size_t i = 0; i < COUNT; ++i)
+            {
+                out[i] = quaternionlib::Normalized<MathPolicy::Deterministic>(Quaternion<double>{
+                    1.0 + static_cast<double>(i), 0.5, -0.25 * static_cast<double>(i), 3.0});
+            }
+
+            return out;
+        }();
+
+        for (std::size_t i = 0; i < COUNT; ++i)
+        {
+            REQUIRE(normalizedAtCompileTime[i] ==
+                    quaternionlib::Normalized<MathPolicy::Deterministic>(Quaternion<double>{
+                        1.0 + static_cast<double>(i), 0.5, -0.25 * static_cast<double>(i), 3.0}));
+        }
+    }
+}
+
+TEST_CASE("Compile-time trigonometry")
+{
+    const auto angle = [](std::size_t i) { return (static_cast<double>(i) - 256.0) / 10.0; };
+
+    constexpr auto sines = Tabulate(
+        [](std::size_t i)
+        { return quaternionlib::details::Sin((static_cast<double>(i) - 256.0) / 10.0); });
+    constexpr auto cosines = Tabulate(
+        [](std::size_t i)
+        { return quaternionlib::details::Cos((static_cast<double>(i) - 256.0) / 10.0); });
+    constexpr auto arctangents = Tabulate(
+        [](std::size_t i)
+        {
+            const double x = (static_cast<double>(i) - 256.0) / 10.0;
+
+            return quaternionlib::details::Atan2(x, 1.5 - x * x);
+        });
+
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+        const double x = angle(i);
+
+        REQUIRE(WithinUlps(sines[i], std::sin(x), 1));
+        REQUIRE(WithinUlps(cosines[i], std::cos(x), 1));
+        REQUIRE(WithinUlps(arctangents[i], std::atan2(x, 1.5 - x * x), 1));
+    }
+
+    SECTION("Special values")
+    {
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+
+        static_assert(quaternionlib::details::Atan2(0.0, -1.0) == std::numbers::pi);
+        static_assert(quaternionlib::details::Atan2(-0.0, 1.0) == 0.0);
+        static_assert(quaternionlib::details::Atan2(1.0, 0.0) == std::numbers::pi / 2);
+        static_assert(quaternionlib::details::Atan2(-infinity, infinity) == -std::numbers::pi / 4);
+        static_assert(quaternionlib::details::Cos(0.0) == 1.0);
+        static_assert(quaternionlib::details::Sin(0.0) == 0.0);
+
+        constexpr double nan = quaternionlib::details::Sin(infinity);
+
+        REQUIRE(std::isnan(nan));
+    }
+}
+
+TEST_CASE("Compile-time rotations")
+{
+    static constexpr auto table = RotationTable();
+
+    static_assert(table[0] == Quaternion<double>{0.0, 0.0, 0.0, 1.0});
+
+    constexpr auto turn = []
+    {
+        Quaternion<double> q{0.0, 0.0, 0.0, 1.0};
+
+        for (std::size_t k = 0; k < 36; ++k)
+        {
+            q = q * table[1];
+        }
+
+        return q;
+    }();
+
+    // A full turn is -1 as a quaternion.
+    static_assert(quaternionlib::AngularDistance(turn, Quaternion<double>{0.0, 0.0, 0.0, 1.0}) <
+                  1e-14);
+    static_assert(quaternionlib::Dot(turn, Quaternion<double>{0.0, 0.0, 0.0, 1.0}) < 0);
+
+    constexpr auto halfway = quaternionlib::Slerp(table[0], table[18], 0.5);
+
+    static_assert(quaternionlib::AngularDistance(halfway, table[9]) < 1e-15);
+    static_assert(
+        quaternionlib::AngularDistance(quaternionlib::Exp(quaternionlib::Log(table[7])), table[7]) <
+        1e-15);
+
+    for (std::size_t k = 0; k < table.size(); ++k)
+    {
+        const double half = static_cast<double>(k) * std::numbers::pi / 36;
+
+        REQUIRE(WithinUlps(table[k].Z(), std::sin(half), 1));
+        REQUIRE(WithinUlps(table[k].W(), std::cos(half), 1));
+    }
+}
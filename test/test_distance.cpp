@@ -0,0 +1,202 @@
+#include <QuaternionDistance.hpp>
+#include "RandomRotations.hpp"
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+    constexpr auto PI = 3.14159265358979323846;
+
+    using quaternionlib::DistanceMetric;
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::test::RandomRotations;
+
+    auto AboutZ(double angle) -> Quaternion<double>
+    {
+        return Quaternion<double>{0.0, 0.0, std::sin(angle / 2), std::cos(angle / 2)};
+    }
+} // namespace
+
+TEST_CASE("Scalar rotation distances")
+{
+    const Quaternion<double> identity{0.0, 0.0, 0.0, 1.0};
+
+    SECTION("Dot product")
+    {
+        constexpr Quaternion<int> a{1, 2, 3, 4};
+        constexpr Quaternion<int> b{5, 6, 7, 8};
+
+        STATIC_REQUIRE(quaternionlib::Dot(a, b) == 70);
+    }
+
+    SECTION("Angle of known rotations")
+    {
+        for (const double angle : {0.0, 0.3, 1.0, 2.5, PI})
+        {
+            REQUIRE(quaternionlib::AngularDistance(identity, AboutZ(angle)) ==
+                    Approx(angle).margin(1e-15));
+            REQUIRE(quaternionlib::InnerProductDistance(identity, AboutZ(angle)) ==
+                    Approx(1 - std::cos(angle / 2)).margin(1e-15));
+        }
+    }
+
+    SECTION("Antipodal quaternions are the same rotation")
+    {
+        const auto q = AboutZ(1.2);
+
+        REQUIRE(quaternionlib::AngularDistance(q, q * -1.0) == 0.0);
+        REQUIRE(quaternionlib::InnerProductDistance(q, q * -1.0) == Approx(0.0).margin(1e-15));
+        REQUIRE(quaternionlib::AngularDistance(AboutZ(0.2), AboutZ(0.7) * -1.0) ==
+                Approx(0.5).epsilon(1e-14));
+    }
+
+    SECTION("Nearly equal rotations keep relative accuracy")
+    {
+        REQUIRE(quaternionlib::AngularDistance(identity, AboutZ(1e-9)) ==
+                Approx(1e-9).epsilon(1e-12));
+        REQUIRE(quaternionlib::Distance(identity, AboutZ(1e-9), DistanceMetric::Angle) ==
+                Approx(1e-9).epsilon(1e-12));
+    }
+}
+
+TEST_CASE("Geodesics")
+{
+    const Quaternion<double> identity{0.0, 0.0, 0.0, 1.0};
+
+    SECTION("Exp and Log are inverse")
+    {
+        for (const auto& q : RandomRotations(100, 11))
+        {
+            const auto canonical = q.W() < 0 ? q * -1.0 : q;
+            const auto back = quaternionlib::Exp(quaternionlib::Log(canonical));
+
+            REQUIRE(quaternionlib::AngularDistance(back, canonical) <= 1e-12);
+        }
+
+        REQUIRE(quaternionlib::Exp(quaternionlib::Log(identity)) == identity);
+        REQUIRE(quaternionlib::Log(AboutZ(0.6)).Z() == Approx(0.3).epsilon(1e-15));
+    }
+
+    SECTION("Slerp moves at constant speed along the shortest path")
+    {
+        for (const double t : {0.0, 0.25, 0.5, 1.0})
+        {
+            const auto q = quaternionlib::Slerp(AboutZ(0.2), AboutZ(1.4), t);
+
+            REQUIRE(quaternionlib::AngularDistance(q, AboutZ(0.2 + 1.2 * t)) <= 1e-14);
+        }
+
+        const auto flipped = quaternionlib::Slerp(AboutZ(0.2), AboutZ(1.4) * -1.0, 0.5);
+
+        REQUIRE(quaternionlib::AngularDistance(flipped, AboutZ(0.8)) <= 1e-14);
+    }
+
+    SECTION("Coincident endpoints")
+    {
+        const auto q = AboutZ(0.7);
+
+        REQUIRE(quaternionlib::AngularDistance(quaternionlib::Slerp(q, q, 0.3), q) == 0.0);
+        REQUIRE(quaternionlib::AngularDistance(quaternionlib::Slerp(q, AboutZ(0.7 + 1e-10), 0.5),
+                                               AboutZ(0.7 + 5e-11)) <= 1e-15);
+    }
+}
+
+TEST_CASE("Batched rotation distances")
+{
+    const auto points = RandomRotations(10000, 1);
+    const auto queries = RandomRotations(70, 2);
+    const QuaternionSoA<double> soa{points};
+
+    SECTION("One to many matches the scalar distances")
+    {
+        for (const auto metric : {DistanceMetric::Angle, DistanceMetric::InnerProduct})
+        {
+            std::vector<double> aos(points.size());
+            std::vector<double> structured(points.size());
+
+            quaternionlib::Distances<double>(queries[0], points, aos, metric, 3);
+            quaternionlib::Distances(queries[0], soa.View(), std::span{structured}, metric);
+
+            REQUIRE(aos == structured);
+
+            for (std::size_t i = 0; i < points.size(); ++i)
+            {
+                REQUIRE(aos[i] ==
+                        Approx(quaternionlib::Distance(queries[0], points[i], metric))
+                            .margin(1e-14));
+            }
+        }
+    }
+
+    SECTION("Distance matrix")
+    {
+        const auto columns = std::span{points}.first(300);
+        std::vector<double> matrix(queries.size() * columns.size());
+        std::vector<double> threaded(matrix.size());
+
+        quaternionlib::DistanceMatrix<double>(queries, columns, matrix);
+        quaternionlib::DistanceMatrix<double>(queries, columns, threaded, DistanceMetric::Angle,
+                                              4);
+
+        REQUIRE(matrix == threaded);
+
+        for (std::size_t i = 0; i < queries.size(); ++i)
+        {
+            for (std::size_t j = 0; j < columns.size(); ++j)
+            {
+                REQUIRE(matrix[i * columns.size() + j] ==
+                        Approx(quaternionlib::AngularDistance(queries[i], columns[j]))
+                            .margin(1e-14));
+            }
+        }
+    }
+
+    SECTION("All pairs of a set are symmetric with a zero diagonal")
+    {
+        const QuaternionSoA<double> set{std::span{points}.first(100)};
+        std::vector<double> matrix(100 * 100);
+
+        quaternionlib::DistanceMatrix(set.View(), set.View(), std::span{matrix},
+                                      DistanceMetric::InnerProduct);
+
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            REQUIRE(matrix[i * 100 + i] == Approx(0.0).margin(1e-15));
+
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                REQUIRE(matrix[i * 100 + j] == matrix[j * 100 + i]);
+            }
+        }
+    }
+
+    SECTION("Nearest neighbour")
+    {
+        for (const auto& query : queries)
+        {
+            std::size_t expected = 0;
+
+            for (std::size_t i = 1; i < points.size(); ++i)
+            {
+                if (quaternionlib::AngularDistance(query, points[i]) <
+                    quaternionlib::AngularDistance(query, points[expected]))
+                {
+                    expected = i;
+                }
+            }
+
+            REQUIRE(quaternionlib::Nearest<double>(query, points) == expected);
+            REQUIRE(quaternionlib::Nearest(query, soa.View()) == expected);
+        }
+
+        REQUIRE_THROWS_AS(
+            quaternionlib::Nearest<double>(queries[0], std::span<const Quaternion<double>>{}),
+            std::invalid_argument);
+    }
+}
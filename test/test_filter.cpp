@@ -0,0 +1,199 @@
+#include <AttitudeFilter.hpp>
+#include <AttitudeIntegrator.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+    struct Vectors
+    {
+        explicit Vectors(std::size_t n)
+            : x(n), y(n), z(n)
+        {
+        }
+
+        [[nodiscard]] auto View() const -> quaternionlib::Vector3SoASpan<const double>
+        {
+            return {x, y, z};
+        }
+
+        std::vector<double> x, y, z;
+    };
+
+    // Gravity direction in the sensor frame as estimated from an orientation.
+    auto Gravity(const quaternionlib::Quaternion<double>& q) -> std::array<double, 3>
+    {
+        return {2 * (q.X() * q.Z() - q.W() * q.Y()), 2 * (q.W() * q.X() + q.Y() * q.Z()),
+                q.W() * q.W() - q.X() * q.X() - q.Y() * q.Y() + q.Z() * q.Z()};
+    }
+
+    auto TiltedAccelerations(std::size_t n) -> Vectors
+    {
+        Vectors accel{n};
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto t = static_cast<double>(i);
+
+            // 9.81 m/s^2 in assorted directions of the upper hemisphere
+            accel.x[i] = 9.81 * std::sin(0.7 * t) * 0.6;
+            accel.y[i] = 9.81 * std::cos(1.3 * t) * 0.6;
+            accel.z[i] = 9.81 * std::sqrt(1.0 - 0.36 * (std::pow(std::sin(0.7 * t), 2) +
+                                                      std::pow(std::cos(1.3 * t), 2)));
+        }
+
+        return accel;
+    }
+
+    template <typename Bank>
+    auto RequireAlignedWithGravity(const Bank& bank, const Vectors& accel, double margin) -> void
+    {
+        for (std::size_t i = 0; i < bank.Size(); ++i)
+        {
+            const auto q = bank.Orientation(i);
+            const auto g = Gravity(q);
+            const double norm =
+                std::sqrt(accel.x[i] * accel.x[i] + accel.y[i] * accel.y[i] + accel.z[i] * accel.z[i]);
+
+            REQUIRE(q.Norm() == Approx(1.0).margin(1e-9));
+            REQUIRE(g[0] == Approx(accel.x[i] / norm).margin(margin));
+            REQUIRE(g[1] == Approx(accel.y[i] / norm).margin(margin));
+            REQUIRE(g[2] == Approx(accel.z[i] / norm).margin(margin));
+        }
+    }
+} // namespace
+
+TEST_CASE("Fast inverse square root")
+{
+    for (const double value : {1e-30, 0.25, 1.0, 2.0, 9.81 * 9.81, 1e30})
+    {
+        REQUIRE(quaternionlib::details::FastInverseSqrt(value) ==
+                Approx(1.0 / std::sqrt(value)).epsilon(1e-10));
+        REQUIRE(quaternionlib::details::FastInverseSqrt(static_cast<float>(value)) ==
+                Approx(1.0 / std::sqrt(value)).epsilon(1e-5));
+    }
+
+    REQUIRE(std::isfinite(quaternionlib::details::FastInverseSqrt(0.0)));
+    REQUIRE(std::isfinite(quaternionlib::details::FastInverseSqrt(0.0f)));
+}
+
+TEST_CASE("Madgwick filter bank")
+{
+    constexpr std::size_t devices = 300;
+
+    SECTION("Converges to the measured gravity")
+    {
+        quaternionlib::MadgwickFilterBank<double> bank{devices, 0.5};
+        const Vectors gyro{devices};
+        const auto accel = TiltedAccelerations(devices);
+
+        for (int step = 0; step < 2000; ++step)
+        {
+            bank.Update(gyro.View(), accel.View(), 0.01);
+        }
+
+        // Madgwick takes fixed-size normalized gradient steps and keeps oscillating around
+        // the optimum with an amplitude of about 2 * beta * dt, so settle with a lower gain.
+        bank.SetBeta(0.01);
+
+        for (int step = 0; step < 1000; ++step)
+        {
+            bank.Update(gyro.View(), accel.View(), 0.01);
+        }
+
+        RequireAlignedWithGravity(bank, accel, 2 * 0.01 * 0.01);
+    }
+
+    SECTION("Integrates the gyroscope when the accelerometer reads zero")
+    {
+        quaternionlib::MadgwickFilterBank<double> bank{devices};
+        Vectors gyro{devices};
+        const Vectors accel{devices};
+
+        for (std::size_t i = 0; i < devices; ++i)
+        {
+            gyro.z[i] = 0.5;
+        }
+
+        for (int step = 0; step < 1000; ++step)
+        {
+            bank.Update(gyro.View(), accel.View(), 0.001);
+        }
+
+        quaternionlib::Quaternion<double> expected{0.0, 0.0, 0.0, 1.0};
+        quaternionlib::IntegrateExponential(expected, 0.0, 0.0, 0.5, 1.0);
+
+        for (std::size_t i = 0; i < devices; ++i)
+        {
+            REQUIRE(bank.Orientation(i).Z() == Approx(expected.Z()).margin(1e-6));
+            REQUIRE(bank.Orientation(i).W() == Approx(expected.W()).margin(1e-6));
+        }
+    }
+
+    SECTION("Threaded updates match single-threaded ones")
+    {
+        constexpr std::size_t many = 20000;
+        quaternionlib::MadgwickFilterBank<double> single{many};
+        quaternionlib::MadgwickFilterBank<double> threaded{many};
+        Vectors gyro{many};
+        const auto accel = TiltedAccelerations(many);
+
+        std::fill(gyro.x.begin(), gyro.x.end(), 0.1);
+
+        for (int step = 0; step < 10; ++step)
+        {
+            single.Update(gyro.View(), accel.View(), 0.01);
+            threaded.Update(gyro.View(), accel.View(), 0.01, 4);
+        }
+
+        for (std::size_t i = 0; i < many; ++i)
+        {
+            REQUIRE(single.Orientation(i) == threaded.Orientation(i));
+        }
+    }
+}
+
+TEST_CASE("Mahony filter bank")
+{
+    constexpr std::size_t devices = 300;
+
+    SECTION("Converges to the measured gravity")
+    {
+        quaternionlib::MahonyFilterBank<double> bank{devices, 2.0};
+        const Vectors gyro{devices};
+        const auto accel = TiltedAccelerations(devices);
+
+        for (int step = 0; step < 2000; ++step)
+        {
+            bank.Update(gyro.View(), accel.View(), 0.01);
+        }
+
+        RequireAlignedWithGravity(bank, accel, 1e-6);
+    }
+
+    SECTION("Integral feedback estimates the gyroscope bias")
+    {
+        quaternionlib::MahonyFilterBank<double> bank{devices, 1.0, 0.3};
+        Vectors gyro{devices};
+        Vectors accel{devices};
+
+        std::fill(gyro.x.begin(), gyro.x.end(), 0.02);
+        std::fill(gyro.y.begin(), gyro.y.end(), -0.01);
+        std::fill(accel.z.begin(), accel.z.end(), 9.81);
+
+        for (int step = 0; step < 10000; ++step)
+        {
+            bank.Update(gyro.View(), accel.View(), 0.01);
+        }
+
+        for (std::size_t i = 0; i < devices; ++i)
+        {
+            REQUIRE(bank.Integrals().x[i] == Approx(-0.02).margin(1e-6));
+            REQUIRE(bank.Integrals().y[i] == Approx(0.01).margin(1e-6));
+        }
+    }
+}
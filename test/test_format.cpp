@@ -0,0 +1,178 @@
+#include <QuaternionFormat.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    auto ToString(const quaternionlib::Quaternion<T>& q, const quaternionlib::TextFormat& format)
+        -> std::string
+    {
+        std::string buffer(quaternionlib::MaxTextSize<T>(format), '\0');
+        const auto result = quaternionlib::ToChars(buffer.data(), buffer.data() + buffer.size(), q,
+                                                   format);
+
+        REQUIRE(result.ec == std::errc{});
+        buffer.resize(static_cast<std::size_t>(result.ptr - buffer.data()));
+
+        return buffer;
+    }
+} // namespace
+
+TEST_CASE("Single quaternion to_chars")
+{
+    constexpr quaternionlib::Quaternion<double> q{1.5, -2.0, 0.25, 4.0};
+
+    SECTION("Quaternion layout matches operator<<")
+    {
+        std::ostringstream stream;
+        stream << q;
+
+        REQUIRE(ToString(q, {quaternionlib::TextLayout::Quaternion}) == stream.str());
+    }
+
+    SECTION("CSV layout")
+    {
+        REQUIRE(ToString(q, {quaternionlib::TextLayout::Csv}) == "1.5,-2,0.25,4");
+    }
+
+    SECTION("JSON layout")
+    {
+        REQUIRE(ToString(q, {quaternionlib::TextLayout::Json}) ==
+                R"({"x":1.5,"y":-2,"z":0.25,"w":4})");
+    }
+
+    SECTION("Fixed precision")
+    {
+        const quaternionlib::TextFormat format{quaternionlib::TextLayout::Csv,
+                                               std::chars_format::fixed, 3};
+
+        REQUIRE(ToString(q, format) == "1.500,-2.000,0.250,4.000");
+    }
+
+    SECTION("Integral components")
+    {
+        constexpr quaternionlib::Quaternion<int> qi{1, -2, 3, 4};
+
+        REQUIRE(ToString(qi, {quaternionlib::TextLayout::Csv}) == "1,-2,3,4");
+    }
+
+    SECTION("Buffer too small")
+    {
+        char buffer[8];
+        const auto result = quaternionlib::ToChars(buffer, buffer + sizeof(buffer), q);
+
+        REQUIRE(result.ec == std::errc::value_too_large);
+        REQUIRE(result.ptr == buffer + sizeof(buffer));
+    }
+}
+
+TEST_CASE("Bulk text writer")
+{
+    const std::vector<quaternionlib::Quaternion<double>> quaternions{{1.0, 2.0, 3.0, 4.0},
+                                                                     {-0.5, 0.0, 0.5, 1.0}};
+
+    SECTION("CSV")
+    {
+        std::vector<char> buffer(quaternionlib::MaxTextSize<double>(quaternions.size()));
+        const auto result = quaternionlib::WriteCsv<double>(quaternions, buffer);
+
+        REQUIRE(result.ec == std::errc{});
+        REQUIRE(std::string_view(buffer.data(), result.ptr) == "1,2,3,4\n-0.5,0,0.5,1\n");
+    }
+
+    SECTION("JSON")
+    {
+        const quaternionlib::TextFormat format{quaternionlib::TextLayout::Json};
+        std::vector<char> buffer(quaternionlib::MaxTextSize<double>(quaternions.size(), format));
+        const auto result = quaternionlib::WriteJson<double>(quaternions, buffer);
+
+        REQUIRE(result.ec == std::errc{});
+        REQUIRE(std::string_view(buffer.data(), result.ptr) ==
+                R"([{"x":1,"y":2,"z":3,"w":4},{"x":-0.5,"y":0,"z":0.5,"w":1}])");
+    }
+
+    SECTION("Empty input")
+    {
+        char buffer[4];
+        const auto result = quaternionlib::WriteJson<double>({}, buffer);
+
+        REQUIRE(result.ec == std::errc{});
+        REQUIRE(std::string_view(buffer, result.ptr) == "[]");
+    }
+
+    SECTION("Upper bound holds for extreme values")
+    {
+        constexpr auto lowest = std::numeric_limits<double>::lowest();
+        constexpr auto denorm = -std::numeric_limits<double>::denorm_min();
+        const std::vector<quaternionlib::Quaternion<double>> extremes{
+            {lowest, denorm, lowest, denorm}};
+
+        for (const auto layout : {quaternionlib::TextLayout::Quaternion,
+                                  quaternionlib::TextLayout::Csv, quaternionlib::TextLayout::Json})
+        {
+            for (const auto chars : {std::chars_format::general, std::chars_format::scientific,
+                                     std::chars_format::fixed, std::chars_format::hex})
+            {
+                const quaternionlib::TextFormat format{layout, chars};
+                std::vector<char> buffer(quaternionlib::MaxTextSize<double>(1, format));
+
+                REQUIRE(quaternionlib::WriteText<double>(extremes, buffer, format).ec ==
+                        std::errc{});
+            }
+        }
+    }
+
+    SECTION("Upper bound holds for hex at a fixed precision")
+    {
+        constexpr auto denorm = std::numeric_limits<double>::denorm_min();
+        const std::vector<quaternionlib::Quaternion<double>> extremes{
+            {-3 * denorm, -3 * denorm, -3 * denorm, -3 * denorm},
+            {std::numeric_limits<double>::lowest(), -denorm, -std::numeric_limits<double>::min(),
+             std::numeric_limits<double>::max()}};
+        const std::vector<quaternionlib::Quaternion<float>> floats{
+            {-3 * std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::lowest(),
+             -std::numeric_limits<float>::min(), -std::numeric_limits<float>::denorm_min()}};
+
+        for (const auto layout : {quaternionlib::TextLayout::Quaternion,
+                                  quaternionlib::TextLayout::Csv, quaternionlib::TextLayout::Json})
+        {
+            for (const int precision : {0, 13, 20})
+            {
+                const quaternionlib::TextFormat format{layout, std::chars_format::hex, precision};
+                std::vector<char> buffer(quaternionlib::MaxTextSize<double>(2, format));
+                std::vector<char> floatBuffer(quaternionlib::MaxTextSize<float>(1, format));
+
+                REQUIRE(quaternionlib::WriteText<double>(extremes, buffer, format).ec ==
+                        std::errc{});
+                REQUIRE(quaternionlib::WriteText<float>(floats, floatBuffer, format).ec ==
+                        std::errc{});
+            }
+        }
+    }
+
+    SECTION("Buffer too small")
+    {
+        std::vector<char> buffer(10);
+        const auto result = quaternionlib::WriteCsv<double>(quaternions, buffer);
+
+        REQUIRE(result.ec == std::errc::value_too_large);
+    }
+}
+
+#if defined(__cpp_lib_format)
+TEST_CASE("std::format support")
+{
+    constexpr quaternionlib::Quaternion<double> q{1.5, -2.0, 0.25, 4.0};
+
+    REQUIRE(std::format("{}", q) == "Quaternion(1.5, -2, 0.25, 4)");
+    REQUIRE(std::format("{:c}", q) == "1.5,-2,0.25,4");
+    REQUIRE(std::format("{:j.1f}", q) == R"({"x":1.5,"y":-2.0,"z":0.2,"w":4.0})");
+    REQUIRE(std::format("{:q.2e}", q) ==
+            "Quaternion(1.50e+00, -2.00e+00, 2.50e-01, 4.00e+00)");
+}
+#endif
@@ -0,0 +1,173 @@
+#include <AttitudeIntegrator.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+    constexpr auto PI = 3.14159265358979323846;
+
+    struct Bodies
+    {
+        explicit Bodies(std::size_t n)
+            : q(n), wx(n), wy(n), wz(n)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const auto t = static_cast<double>(i);
+
+                q.View().Store(i, quaternionlib::Quaternion<double>{std::sin(t), std::cos(t),
+                                                                    0.5, 1.0}
+                                      .Normalized());
+                wx[i] = std::sin(0.3 * t);
+                wy[i] = std::cos(0.7 * t) * 2.0;
+                wz[i] = 0.1 * t;
+            }
+        }
+
+        [[nodiscard]] auto Omega() const -> quaternionlib::Vector3SoASpan<const double>
+        {
+            return {wx, wy, wz};
+        }
+
+        quaternionlib::QuaternionSoA<double> q;
+        std::vector<double> wx, wy, wz;
+    };
+} // namespace
+
+TEST_CASE("Exponential map integration")
+{
+    SECTION("Constant rotation about a single axis")
+    {
+        constexpr double omega = 0.8;
+        constexpr double dt = 0.01;
+        constexpr int steps = 1000;
+
+        quaternionlib::Quaternion<double> q{0.0, 0.0, 0.0, 1.0};
+
+        for (int i = 0; i < steps; ++i)
+        {
+            quaternionlib::IntegrateExponential(q, 0.0, 0.0, omega, dt);
+        }
+
+        const double angle = omega * dt * steps / 2;
+
+        REQUIRE(q.X() == Approx(0.0).margin(1e-12));
+        REQUIRE(q.Z() == Approx(std::sin(angle)).margin(1e-12));
+        REQUIRE(q.W() == Approx(std::cos(angle)).margin(1e-12));
+    }
+
+    SECTION("Large steps fall back to exact trigonometry")
+    {
+        quaternionlib::Quaternion<double> q{0.0, 0.0, 0.0, 1.0};
+        quaternionlib::IntegrateExponential(q, PI, 0.0, 0.0, 1.0);
+
+        REQUIRE(q.X() == Approx(1.0));
+        REQUIRE(q.W() == Approx(0.0).margin(1e-15));
+    }
+
+    SECTION("Batched kernel matches the scalar one")
+    {
+        Bodies bodies{1000};
+        auto expected = bodies.q.ToAoS();
+
+        // one body gets a step large enough for the fallback path
+        bodies.wx[17] = 300.0;
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            quaternionlib::IntegrateExponential(expected[i], bodies.wx[i], bodies.wy[i],
+                                                bodies.wz[i], 0.01);
+        }
+
+        quaternionlib::IntegrateExponential(bodies.q.View(), bodies.Omega(), 0.01);
+
+        const auto result = bodies.q.ToAoS();
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            REQUIRE(result[i].X() == Approx(expected[i].X()).margin(1e-14));
+            REQUIRE(result[i].Y() == Approx(expected[i].Y()).margin(1e-14));
+            REQUIRE(result[i].Z() == Approx(expected[i].Z()).margin(1e-14));
+            REQUIRE(result[i].W() == Approx(expected[i].W()).margin(1e-14));
+        }
+    }
+
+    SECTION("Norm is preserved without renormalization")
+    {
+        Bodies bodies{64};
+
+        for (int step = 0; step < 10000; ++step)
+        {
+            quaternionlib::IntegrateExponential(bodies.q.View(), bodies.Omega(), 0.001);
+        }
+
+        for (const auto& q : bodies.q.ToAoS())
+        {
+            REQUIRE(q.Norm() == Approx(1.0).margin(1e-12));
+        }
+    }
+}
+
+TEST_CASE("RK4 integration")
+{
+    SECTION("Agrees with the exponential map for constant angular velocity")
+    {
+        Bodies exponential{256};
+        Bodies rk4{256};
+
+        for (int step = 0; step < 500; ++step)
+        {
+            quaternionlib::IntegrateExponential(exponential.q.View(), exponential.Omega(), 0.002);
+            quaternionlib::IntegrateRK4(rk4.q.View(), rk4.Omega(), 0.002);
+        }
+
+        const auto expected = exponential.q.ToAoS();
+        const auto result = rk4.q.ToAoS();
+
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            REQUIRE(result[i].X() == Approx(expected[i].X()).margin(1e-6));
+            REQUIRE(result[i].Y() == Approx(expected[i].Y()).margin(1e-6));
+            REQUIRE(result[i].Z() == Approx(expected[i].Z()).margin(1e-6));
+            REQUIRE(result[i].W() == Approx(expected[i].W()).margin(1e-6));
+            REQUIRE(result[i].Norm() == Approx(1.0));
+        }
+    }
+
+    SECTION("Scalar step matches the batched one")
+    {
+        quaternionlib::Quaternion<double> q{0.1, 0.2, 0.3, 0.9};
+        q.Normalize();
+
+        double x = q.X(), y = q.Y(), z = q.Z(), w = q.W();
+        const double ax = 1.0, ay = -2.0, az = 0.5, bx = 1.5, by = -1.0, bz = 0.0;
+
+        quaternionlib::IntegrateRK4(q, ax, ay, az, bx, by, bz, 0.02);
+        quaternionlib::IntegrateRK4(quaternionlib::QuaternionSoASpan<double>{{&x, 1}, {&y, 1},
+                                                                             {&z, 1}, {&w, 1}},
+                                    quaternionlib::Vector3SoASpan<const double>{
+                                        {&ax, 1}, {&ay, 1}, {&az, 1}},
+                                    quaternionlib::Vector3SoASpan<const double>{
+                                        {&bx, 1}, {&by, 1}, {&bz, 1}},
+                                    0.02);
+
+        REQUIRE(q == quaternionlib::Quaternion<double>{x, y, z, w});
+    }
+}
+
+TEST_CASE("Multithreaded integration")
+{
+    Bodies single{20000};
+    Bodies threaded{20000};
+
+    quaternionlib::IntegrateExponential(single.q.View(), single.Omega(), 0.01);
+    quaternionlib::IntegrateExponential(threaded.q.View(), threaded.Omega(), 0.01, 4);
+    quaternionlib::IntegrateRK4(single.q.View(), single.Omega(), 0.01);
+    quaternionlib::IntegrateRK4(threaded.q.View(), threaded.Omega(), 0.01, 4);
+
+    REQUIRE(single.q.ToAoS() == threaded.q.ToAoS());
+}
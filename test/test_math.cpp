@@ -0,0 +1,200 @@
+#include <QuaternionMath.hpp>
+#include "RandomRotations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// Built with -ffp-contract=fast, so the deterministic results below would change on targets
+// with FMA if any product were contracted.
+namespace
+{
+    using quaternionlib::MathPolicy;
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::test::RandomRotations;
+
+    constexpr auto DETERMINISTIC = MathPolicy::Deterministic;
+    constexpr auto FAST = MathPolicy::Fast;
+
+    // Hides the value from the optimizer, so the callee runs at run time.
+    template <typename T>
+    auto Opaque(const Quaternion<T>& q) -> Quaternion<T>
+    {
+        volatile T x = q.X(), y = q.Y(), z = q.Z(), w = q.W();
+
+        return Quaternion<T>{static_cast<T>(x), static_cast<T>(y), static_cast<T>(z),
+                             static_cast<T>(w)};
+    }
+
+    // Each product stored to memory before it is summed, in the documented order.
+    template <typename T>
+    auto ReferenceProduct(const Quaternion<T>& a, const Quaternion<T>& b) -> Quaternion<T>
+    {
+        enum : std::size_t
+        {
+            W,
+            X,
+            Y,
+            Z
+        };
+
+        const T lhs[4] = {a.W(), a.X(), a.Y(), a.Z()};
+        const T rhs[4] = {b.W(), b.X(), b.Y(), b.Z()};
+        volatile T p[4][4];
+
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+                p[i][j] = lhs[i] * rhs[j];
+            }
+        }
+
+        return Quaternion<T>{((p[W][X] + p[X][W]) + p[Y][Z]) - p[Z][Y],
+                             ((p[W][Y] - p[X][Z]) + p[Y][W]) + p[Z][X],
+                             ((p[W][Z] + p[X][Y]) - p[Y][X]) + p[Z][W],
+                             ((p[W][W] - p[X][X]) - p[Y][Y]) - p[Z][Z]};
+    }
+
+    template <typename T>
+    auto BitEqual(const Quaternion<T>& a, const Quaternion<T>& b) -> bool
+    {
+        using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+        return std::bit_cast<Bits>(a.X()) == std::bit_cast<Bits>(b.X()) &&
+               std::bit_cast<Bits>(a.Y()) == std::bit_cast<Bits>(b.Y()) &&
+               std::bit_cast<Bits>(a.Z()) == std::bit_cast<Bits>(b.Z()) &&
+               std::bit_cast<Bits>(a.W()) == std::bit_cast<Bits>(b.W());
+    }
+
+    template <typename T>
+    auto WithinUlps(const Quaternion<T>& a, const Quaternion<T>& b, T ulps) -> bool
+    {
+        const T tolerance = ulps * std::numeric_limits<T>::epsilon();
+
+        return std::abs(a.X() - b.X()) <= tolerance && std::abs(a.Y() - b.Y()) <= tolerance &&
+               std::abs(a.Z() - b.Z()) <= tolerance && std::abs(a.W() - b.W()) <= tolerance;
+    }
+} // namespace
+
+TEST_CASE("Deterministic math is reproducible")
+{
+    SECTION("Run time matches constant evaluation")
+    {
+        constexpr Quaternion<double> a{0.1, -0.7, 0.3, 0.2};
+        constexpr Quaternion<double> b{-0.45, 0.6, 0.15, 0.35};
+        constexpr auto product = quaternionlib::Multiply<DETERMINISTIC>(a, b);
+        constexpr auto normalized = quaternionlib::Normalized<DETERMINISTIC>(a);
+        constexpr auto squaredNorm = quaternionlib::SquaredNorm<DETERMINISTIC>(b);
+
+        constexpr Quaternion<double> two{0.0, 0.0, 0.0, 2.0};
+        constexpr Quaternion<double> c{1.0, 2.0, 3.0, 4.0};
+
+        STATIC_REQUIRE(quaternionlib::Multiply<DETERMINISTIC>(two, c) == c * 2.0);
+
+        REQUIRE(BitEqual(quaternionlib::Multiply<DETERMINISTIC>(Opaque(a), Opaque(b)), product));
+        REQUIRE(BitEqual(quaternionlib::Normalized<DETERMINISTIC>(Opaque(a)), normalized));
+        REQUIRE(std::bit_cast<std::uint64_t>(
+                    quaternionlib::SquaredNorm<DETERMINISTIC>(Opaque(b))) ==
+                std::bit_cast<std::uint64_t>(squaredNorm));
+    }
+
+    SECTION("Products are rounded before they are summed")
+    {
+        const auto lhs = RandomRotations<double>(1000, 1);
+        const auto rhs = RandomRotations<double>(1000, 2);
+        const auto lhsFloat = RandomRotations<float>(1000, 3);
+        const auto rhsFloat = RandomRotations<float>(1000, 4);
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            REQUIRE(BitEqual(quaternionlib::Multiply<DETERMINISTIC>(lhs[i], rhs[i]),
+                             ReferenceProduct(lhs[i], rhs[i])));
+            REQUIRE(BitEqual(quaternionlib::Multiply<DETERMINISTIC>(lhsFloat[i], rhsFloat[i]),
+                             ReferenceProduct(lhsFloat[i], rhsFloat[i])));
+        }
+    }
+
+    SECTION("Batched results are bit-identical to the scalar ones")
+    {
+        const auto lhs = RandomRotations<double>(5000, 5);
+        const auto rhs = RandomRotations<double>(5000, 6);
+        const QuaternionSoA<double> left{lhs};
+        const QuaternionSoA<double> right{rhs};
+        QuaternionSoA<double> out(lhs.size());
+
+        quaternionlib::Multiply<DETERMINISTIC, double>(left.View(), right.View(), out.View(), 2);
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            REQUIRE(BitEqual(out.View().Load(i),
+                             quaternionlib::Multiply<DETERMINISTIC>(lhs[i], rhs[i])));
+        }
+
+        const auto products = out;
+        quaternionlib::Normalize<DETERMINISTIC, double>(out.View());
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            REQUIRE(BitEqual(out.View().Load(i),
+                             quaternionlib::Normalized<DETERMINISTIC>(products.View().Load(i))));
+        }
+    }
+}
+
+TEST_CASE("Fast math agrees with deterministic math")
+{
+    const auto lhs = RandomRotations<double>(5000, 7);
+    const auto rhs = RandomRotations<double>(5000, 8);
+    const QuaternionSoA<double> left{lhs};
+    const QuaternionSoA<double> right{rhs};
+    QuaternionSoA<double> out(lhs.size());
+
+    SECTION("Scalar")
+    {
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            const auto scaled = lhs[i] * 3.0;
+
+            REQUIRE(WithinUlps(quaternionlib::Multiply<FAST>(lhs[i], rhs[i]),
+                               quaternionlib::Multiply<DETERMINISTIC>(lhs[i], rhs[i]), 4.0));
+            REQUIRE(WithinUlps(quaternionlib::Normalized<FAST>(scaled),
+                               quaternionlib::Normalized<DETERMINISTIC>(scaled), 4.0));
+            REQUIRE(std::abs(quaternionlib::Norm<FAST>(scaled) -
+                             quaternionlib::Norm<DETERMINISTIC>(scaled)) <=
+                    8 * std::numeric_limits<double>::epsilon());
+        }
+
+        const Quaternion<float> q{0.5f, -1.5f, 2.0f, 0.25f};
+
+        REQUIRE(WithinUlps(quaternionlib::Normalized<FAST>(q),
+                           quaternionlib::Normalized<DETERMINISTIC>(q), 4.0f));
+    }
+
+    SECTION("Batched")
+    {
+        quaternionlib::Multiply<FAST, double>(left.View(), right.View(), out.View());
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            REQUIRE(WithinUlps(out.View().Load(i), quaternionlib::Multiply<FAST>(lhs[i], rhs[i]),
+                               4.0));
+        }
+
+        quaternionlib::Multiply<FAST, double>(out.View(), right.View(), out.View(), 3);
+        quaternionlib::Normalize<FAST, double>(out.View(), 3);
+
+        for (std::size_t i = 0; i < lhs.size(); ++i)
+        {
+            const auto expected = quaternionlib::Normalized<DETERMINISTIC>(
+                quaternionlib::Multiply<DETERMINISTIC>(
+                    quaternionlib::Multiply<DETERMINISTIC>(lhs[i], rhs[i]), rhs[i]));
+
+            REQUIRE(WithinUlps(out.View().Load(i), expected, 8.0));
+        }
+    }
+}
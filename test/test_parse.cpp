@@ -0,0 +1,159 @@
+#include <QuaternionFormat.hpp>
+#include <QuaternionParse.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("Parsing a single record")
+{
+    quaternionlib::Quaternion<double> q;
+
+    SECTION("operator<< format")
+    {
+        constexpr quaternionlib::Quaternion<double> expected{1.5, -2.0, 0.25, 4.0};
+        std::ostringstream stream;
+        stream << expected;
+        const auto text = stream.str();
+
+        const auto result = quaternionlib::FromChars(text.data(), text.data() + text.size(), q);
+
+        REQUIRE(result.ec == std::errc{});
+        REQUIRE(result.ptr == text.data() + text.size());
+        REQUIRE(q == expected);
+    }
+
+    SECTION("CSV with blanks")
+    {
+        const std::string text = " 1, 2 ,3,\t-4\r";
+        const auto result = quaternionlib::FromChars(text.data(), text.data() + text.size(), q);
+
+        REQUIRE(result.ec == std::errc{});
+        REQUIRE(result.ptr == text.data() + text.size());
+        REQUIRE(q == quaternionlib::Quaternion<double>{1.0, 2.0, 3.0, -4.0});
+    }
+
+    SECTION("Integral components")
+    {
+        quaternionlib::Quaternion<int> qi;
+        const std::string text = "1,2,3,4";
+        const auto result = quaternionlib::FromChars(text.data(), text.data() + text.size(), qi);
+
+        REQUIRE(result.ec == std::errc{});
+        REQUIRE(qi == quaternionlib::Quaternion<int>{1, 2, 3, 4});
+    }
+
+    SECTION("Malformed records")
+    {
+        for (const std::string text : {"1,2,3", "1,2,x,4", "Quaternion(1, 2, 3, 4", "1;2;3;4", ""})
+        {
+            const auto result = quaternionlib::FromChars(text.data(), text.data() + text.size(), q);
+
+            REQUIRE(result.ec == std::errc::invalid_argument);
+        }
+    }
+}
+
+TEST_CASE("Parsing text")
+{
+    SECTION("Round trip through the bulk writer")
+    {
+        std::vector<quaternionlib::Quaternion<double>> quaternions;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            quaternions.emplace_back(0.1 * i, -1.0 / (i + 1), 3.0e-7 * i, 1.0 + i);
+        }
+
+        std::vector<char> buffer(quaternionlib::MaxTextSize<double>(quaternions.size()));
+        const auto written = quaternionlib::WriteCsv<double>(quaternions, buffer);
+        const auto parsed =
+            quaternionlib::ParseText<double>(std::string_view(buffer.data(), written.ptr));
+
+        REQUIRE(parsed == quaternions);
+    }
+
+    SECTION("Mixed layouts and blank lines")
+    {
+        const auto parsed =
+            quaternionlib::ParseText<float>("Quaternion(1, 2, 3, 4)\r\n\n  \n5,6,7,8");
+
+        REQUIRE(parsed.size() == 2);
+        REQUIRE(parsed[0] == quaternionlib::Quaternion<float>{1, 2, 3, 4});
+        REQUIRE(parsed[1] == quaternionlib::Quaternion<float>{5, 6, 7, 8});
+    }
+
+    SECTION("Malformed line is reported")
+    {
+        REQUIRE_THROWS_AS(quaternionlib::ParseText<double>("1,2,3,4\n1,2,3\n"),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("Parallel parsing")
+{
+    std::string text;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        text += std::to_string(i) + ",1,2,3\n";
+
+        if (i % 7 == 0)
+        {
+            text += "\n";
+        }
+    }
+
+    const auto sequential = quaternionlib::ParseText<double>(text);
+    const auto parallel = quaternionlib::ParseTextParallel<double>(text, 4);
+
+    REQUIRE(sequential.size() == 20000);
+    REQUIRE(parallel == sequential);
+
+    text += "oops\n";
+
+    REQUIRE_THROWS_AS(quaternionlib::ParseTextParallel<double>(text, 4), std::invalid_argument);
+}
+
+TEST_CASE("Streaming parser")
+{
+    const std::string text = "1,2,3,4\nQuaternion(5, 6, 7, 8)\n9,10,11,12";
+    const auto expected = quaternionlib::ParseText<double>(text);
+
+    for (std::size_t chunkSize = 1; chunkSize <= text.size(); ++chunkSize)
+    {
+        quaternionlib::QuaternionStreamParser<double> parser;
+        std::vector<quaternionlib::Quaternion<double>> parsed;
+
+        for (std::size_t i = 0; i < text.size(); i += chunkSize)
+        {
+            parser.Feed(std::string_view(text).substr(i, chunkSize), parsed);
+        }
+
+        parser.Finish(parsed);
+
+        REQUIRE(parsed == expected);
+    }
+}
+
+#if defined(QUATERNIONLIB_HAS_MMAP)
+TEST_CASE("Parsing a memory mapped file")
+{
+    const std::string path = "quaternionlib_parse_test.csv";
+
+    {
+        std::ofstream file{path};
+        file << "1,2,3,4\n" << quaternionlib::Quaternion<double>{5, 6, 7, 8} << "\n";
+    }
+
+    const auto parsed = quaternionlib::ParseFile<double>(path, 2);
+    std::remove(path.c_str());
+
+    REQUIRE(parsed.size() == 2);
+    REQUIRE(parsed[1] == quaternionlib::Quaternion<double>{5, 6, 7, 8});
+
+    REQUIRE_THROWS_AS(quaternionlib::ParseFile<double>("does/not/exist.csv"), std::system_error);
+}
+#endif
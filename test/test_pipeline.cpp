@@ -0,0 +1,244 @@
+#include <QuaternionPipeline.hpp>
+#include "RandomRotations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using quaternionlib::Generator;
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionChunk;
+    using quaternionlib::test::RandomRotations;
+
+    namespace pipeline = quaternionlib::pipeline;
+
+    auto Collect(Generator<QuaternionChunk<double>> source) -> std::vector<Quaternion<double>>
+    {
+        std::vector<Quaternion<double>> out;
+
+        for (const auto chunk : source)
+        {
+            out.insert(out.end(), chunk.begin(), chunk.end());
+        }
+
+        return out;
+    }
+
+    auto Counting(int count) -> Generator<int>
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            co_yield i;
+        }
+    }
+
+    auto Failing() -> Generator<QuaternionChunk<double>>
+    {
+        const Quaternion<double> q{0.0, 0.0, 0.0, 1.0};
+        co_yield QuaternionChunk<double>{&q, 1};
+
+        throw std::runtime_error("Sensor disconnected.");
+    }
+} // namespace
+
+TEST_CASE("Generator")
+{
+    SECTION("Yields every value in order")
+    {
+        std::vector<int> values;
+
+        for (const int i : Counting(5))
+        {
+            values.push_back(i);
+        }
+
+        REQUIRE(values == std::vector<int>{0, 1, 2, 3, 4});
+    }
+
+    SECTION("Exceptions reach the consumer")
+    {
+        auto source = Failing();
+        auto it = source.begin();
+
+        REQUIRE(it != source.end());
+        REQUIRE_THROWS_AS(++it, std::runtime_error);
+    }
+}
+
+TEST_CASE("Pipeline stages")
+{
+    const auto rotations = RandomRotations(10000, 1);
+
+    SECTION("Chunks cover the input without copying")
+    {
+        std::size_t chunks = 0;
+        std::size_t offset = 0;
+
+        for (const auto chunk : pipeline::Chunks<double>(rotations, 1000))
+        {
+            REQUIRE(chunk.data() == rotations.data() + offset);
+            offset += chunk.size();
+            ++chunks;
+        }
+
+        REQUIRE(chunks == 10);
+        REQUIRE(offset == rotations.size());
+    }
+
+    SECTION("Text round trip through parse and write")
+    {
+        std::ostringstream text;
+        pipeline::Write(pipeline::Chunks<double>(rotations), text);
+
+        // Small text blocks split records between chunks.
+        std::istringstream in{text.str()};
+        const auto parsed = Collect(pipeline::Parse<double>(pipeline::ReadText(in, 100)));
+
+        REQUIRE(parsed == rotations);
+
+        std::ostringstream json;
+        const auto written = pipeline::Write(pipeline::Chunks<double>(rotations, 3), json,
+                                             {quaternionlib::TextLayout::Json});
+        std::vector<char> expected(quaternionlib::MaxTextSize<double>(
+            rotations.size(), {quaternionlib::TextLayout::Json}));
+        const auto result = quaternionlib::WriteJson<double>(rotations, expected);
+
+        REQUIRE(written == rotations.size());
+        REQUIRE(json.str() == std::string(expected.data(), result.ptr));
+    }
+
+    SECTION("Extreme values are written whole")
+    {
+        constexpr auto denorm = std::numeric_limits<double>::denorm_min();
+        const std::vector<Quaternion<double>> extremes(
+            5, Quaternion<double>{-3 * denorm, std::numeric_limits<double>::lowest(), -denorm,
+                                  -std::numeric_limits<double>::min()});
+
+        for (const auto chars : {std::chars_format::general, std::chars_format::hex})
+        {
+            const quaternionlib::TextFormat format{quaternionlib::TextLayout::Csv, chars, 13};
+
+            std::ostringstream text;
+            const auto written =
+                pipeline::Write(pipeline::Chunks<double>(extremes, 2), text, format);
+            std::vector<char> expected(quaternionlib::MaxTextSize<double>(extremes.size(), format));
+            const auto result = quaternionlib::WriteText<double>(extremes, expected, format);
+
+            REQUIRE(result.ec == std::errc{});
+            REQUIRE(written == extremes.size());
+            REQUIRE(text.str() == std::string(expected.data(), result.ptr));
+        }
+    }
+
+    SECTION("Normalize, map and downsample")
+    {
+        std::vector<Quaternion<double>> scaled;
+
+        for (const auto& q : rotations)
+        {
+            scaled.push_back(q * 3.0);
+        }
+
+        const auto out = Collect(pipeline::Downsample(
+            pipeline::Map(pipeline::Normalize(pipeline::Chunks<double>(scaled, 333)),
+                          [](std::span<Quaternion<double>> chunk)
+                          {
+                              for (auto& q : chunk)
+                              {
+                                  q = q.Conjugated();
+                              }
+                          }),
+            7));
+
+        REQUIRE(out.size() == (rotations.size() + 6) / 7);
+
+        for (std::size_t i = 0; i < out.size(); ++i)
+        {
+            REQUIRE(quaternionlib::AngularDistance(out[i], rotations[7 * i].Conjugated()) <=
+                    1e-7);
+        }
+    }
+
+    SECTION("Upsample interpolates across chunk boundaries")
+    {
+        const std::vector<Quaternion<double>> keys(rotations.begin(), rotations.begin() + 100);
+        const auto out = Collect(pipeline::Upsample(pipeline::Chunks<double>(keys, 7), 4));
+
+        REQUIRE(out.size() == 4 * (keys.size() - 1) + 1);
+
+        for (std::size_t i = 0; i + 1 < keys.size(); ++i)
+        {
+            REQUIRE(out[4 * i] == keys[i]);
+            REQUIRE(quaternionlib::AngularDistance(
+                        out[4 * i + 2], quaternionlib::Slerp(keys[i], keys[i + 1], 0.5)) <= 1e-15);
+        }
+
+        REQUIRE(out.back() == keys.back());
+    }
+
+    SECTION("Invalid factors")
+    {
+        REQUIRE_THROWS_AS(pipeline::Downsample(pipeline::Chunks<double>(rotations), 0),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(pipeline::Upsample(pipeline::Chunks<double>(rotations), 0),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(pipeline::Threaded(pipeline::Chunks<double>(rotations), 0),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(pipeline::Chunks<double>(rotations, 0), std::invalid_argument);
+
+        std::istringstream text{"0 0 0 1\n"};
+        REQUIRE_THROWS_AS(pipeline::ReadText(text, 0), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Threaded pipeline stages")
+{
+    const auto rotations = RandomRotations(20000, 2);
+
+    SECTION("Results match the single-threaded pipeline")
+    {
+        const auto threaded = Collect(pipeline::Threaded(
+            pipeline::Normalize(pipeline::Threaded(pipeline::Chunks<double>(rotations, 100), 2)),
+            3));
+
+        REQUIRE(threaded == Collect(pipeline::Normalize(pipeline::Chunks<double>(rotations))));
+    }
+
+    SECTION("A slow consumer holds the producer back")
+    {
+        std::atomic<std::size_t> produced = 0;
+        auto counted = pipeline::Map(pipeline::Chunks<double>(rotations, 100),
+                                     [&](std::span<Quaternion<double>>) { ++produced; });
+        auto threaded = pipeline::Threaded(std::move(counted), 2);
+        auto it = threaded.begin();
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // Two chunks queued, one in the worker waiting for a free buffer, one with the consumer.
+        REQUIRE(produced <= 4);
+        REQUIRE(it != threaded.end());
+    }
+
+    SECTION("Abandoning a pipeline stops its worker")
+    {
+        auto threaded = pipeline::Threaded(pipeline::Chunks<double>(rotations, 10), 1);
+        auto it = threaded.begin();
+
+        REQUIRE((*it).size() == 10);
+    }
+
+    SECTION("Exceptions cross threads")
+    {
+        auto threaded = pipeline::Threaded(Failing(), 2);
+
+        REQUIRE_THROWS_AS(Collect(std::move(threaded)), std::runtime_error);
+    }
+}
@@ -0,0 +1,98 @@
+#include <QuaternionProduct.hpp>
+#include "RandomRotations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    using quaternionlib::ComponentOrder;
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::QuaternionStridedView;
+    using quaternionlib::test::RandomRotations;
+
+    auto Close(const Quaternion<double>& a, const Quaternion<double>& b) -> bool
+    {
+        constexpr double tolerance = 1e-15;
+
+        return std::abs(a.X() - b.X()) <= tolerance && std::abs(a.Y() - b.Y()) <= tolerance &&
+               std::abs(a.Z() - b.Z()) <= tolerance && std::abs(a.W() - b.W()) <= tolerance;
+    }
+} // namespace
+
+TEST_CASE("One-to-many products")
+{
+    const auto points = RandomRotations(5000, 1);
+    const Quaternion<double> q = Quaternion<double>{0.3, -1.2, 0.7, 2.0}.Normalized();
+
+    SECTION("Matrices match the Hamilton product")
+    {
+        constexpr Quaternion<double> a{1.0, 2.0, 3.0, 4.0};
+        constexpr Quaternion<double> b{-5.0, 6.0, 7.0, -8.0};
+        std::vector<Quaternion<double>> products{b};
+
+        quaternionlib::LeftMultiplyAll<double>(a, products);
+        REQUIRE(products.front() == a * b);
+
+        products.front() = b;
+        quaternionlib::RightMultiplyAll<double>(products, a);
+        REQUIRE(products.front() == b * a);
+    }
+
+    SECTION("AoS, out of place and in place")
+    {
+        std::vector<Quaternion<double>> left(points.size());
+        std::vector<Quaternion<double>> right = points;
+
+        quaternionlib::LeftMultiplyAll<double>(q, points, left, 3);
+        quaternionlib::RightMultiplyAll<double>(right, q);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(Close(left[i], q * points[i]));
+            REQUIRE(Close(right[i], points[i] * q));
+        }
+    }
+
+    SECTION("SoA, out of place and in place")
+    {
+        const QuaternionSoA<double> in{points};
+        QuaternionSoA<double> left(points.size());
+        QuaternionSoA<double> right{points};
+
+        quaternionlib::LeftMultiplyAll<double>(q, in.View(), left.View());
+        quaternionlib::RightMultiplyAll<double>(right.View(), q, 2);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(Close(left.View().Load(i), q * points[i]));
+            REQUIRE(Close(right.View().Load(i), points[i] * q));
+        }
+    }
+
+    SECTION("Strided views")
+    {
+        std::vector<double> buffer;
+
+        for (const auto& p : points)
+        {
+            buffer.insert(buffer.end(), {p.W(), p.X(), p.Y(), p.Z()});
+        }
+
+        std::vector<double> packed(buffer.size());
+        const QuaternionStridedView<double, ComponentOrder::WXYZ> view{buffer.data(),
+                                                                        points.size()};
+        const QuaternionStridedView<const double, ComponentOrder::WXYZ> readOnly{view};
+        const QuaternionStridedView<double> out{packed.data(), points.size()};
+
+        quaternionlib::LeftMultiplyAll(q, readOnly, out);
+        quaternionlib::RightMultiplyAll(view, q);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            REQUIRE(Close(out.Load(i), q * points[i]));
+            REQUIRE(Close(view.Load(i), points[i] * q));
+        }
+    }
+}
@@ -0,0 +1,199 @@
+#include <QuaternionRandom.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using Catch::Approx;
+
+namespace
+{
+    constexpr auto PI = 3.14159265358979323846;
+
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::RandomRotationGenerator;
+
+    auto AngleBetween(const Quaternion<double>& a, const Quaternion<double>& b) -> double
+    {
+        const double dot = a.X() * b.X() + a.Y() * b.Y() + a.Z() * b.Z() + a.W() * b.W();
+
+        return 2 * std::acos(std::min(std::abs(dot), 1.0));
+    }
+
+    template <typename T>
+    auto IsUnit(const Quaternion<T>& q, T tolerance) -> bool
+    {
+        return std::abs(q.SquaredNorm() - 1) <= tolerance;
+    }
+} // namespace
+
+TEST_CASE("Random number kernels")
+{
+    SECTION("Philox4x32-10 known answer")
+    {
+        constexpr auto block = quaternionlib::details::Philox4x32(0, 0, 0);
+
+        STATIC_REQUIRE(block.v[0] == 0x6627E8D5);
+        STATIC_REQUIRE(block.v[1] == 0xE169C58D);
+        STATIC_REQUIRE(block.v[2] == 0xBC57AC4C);
+        STATIC_REQUIRE(block.v[3] == 0x9B00DBD8);
+    }
+
+    SECTION("Unit interval excludes both ends")
+    {
+        using quaternionlib::details::ToUnitInterval;
+
+        STATIC_REQUIRE(ToUnitInterval<float>(0) > 0);
+        STATIC_REQUIRE(ToUnitInterval<float>(0xFFFFFFFF) < 1);
+        STATIC_REQUIRE(ToUnitInterval<double>(0) > 0);
+        STATIC_REQUIRE(ToUnitInterval<double>(0xFFFFFFFF) < 1);
+    }
+
+    SECTION("Polynomial sin and cos of full turns")
+    {
+        for (int i = 0; i <= 1000; ++i)
+        {
+            const double u = i / 1000.0;
+            double s = 0, c = 0;
+            quaternionlib::details::SinCos2Pi(u, s, c);
+
+            REQUIRE(std::abs(s - std::sin(2 * PI * u)) < 1e-15);
+            REQUIRE(std::abs(c - std::cos(2 * PI * u)) < 1e-15);
+        }
+    }
+
+    SECTION("Square and cube roots")
+    {
+        for (const double x : {1e-30, 1e-6, 0.3, 1.0, 7.5, 1e20})
+        {
+            REQUIRE(quaternionlib::details::FastSqrt(x) == Approx(std::sqrt(x)).epsilon(1e-15));
+            REQUIRE(quaternionlib::details::Cbrt(x) == Approx(std::cbrt(x)).epsilon(1e-15));
+        }
+    }
+}
+
+TEST_CASE("Uniform random rotations")
+{
+    constexpr std::size_t count = 200000;
+    const RandomRotationGenerator<double> generator{42};
+
+    std::vector<Quaternion<double>> samples(count);
+    generator.Generate(samples);
+
+    SECTION("Samples are unit quaternions")
+    {
+        for (const auto& q : samples)
+        {
+            REQUIRE(IsUnit(q, 1e-15));
+        }
+    }
+
+    SECTION("Samples depend only on seed and index")
+    {
+        std::vector<Quaternion<double>> threaded(count);
+        generator.Generate(threaded, 0, 4);
+
+        QuaternionSoA<double> soa(1000);
+        generator.Generate(soa.View(), 5000);
+
+        REQUIRE(threaded == samples);
+        REQUIRE(generator(12345) == samples[12345]);
+
+        for (std::size_t i = 0; i < soa.Size(); ++i)
+        {
+            REQUIRE(soa.View().Load(i) == samples[5000 + i]);
+        }
+
+        REQUIRE(RandomRotationGenerator<double>{43}(0) != samples[0]);
+    }
+
+    SECTION("Moments match the uniform distribution on the 3-sphere")
+    {
+        double mean[4] = {};
+        double square[4] = {};
+        double absW = 0;
+
+        for (const auto& q : samples)
+        {
+            const double c[4] = {q.X(), q.Y(), q.Z(), q.W()};
+
+            for (int k = 0; k < 4; ++k)
+            {
+                mean[k] += c[k] / count;
+                square[k] += c[k] * c[k] / count;
+            }
+
+            absW += std::abs(q.W()) / count;
+        }
+
+        for (int k = 0; k < 4; ++k)
+        {
+            REQUIRE(std::abs(mean[k]) < 3e-3);
+            REQUIRE(square[k] == Approx(0.25).margin(3e-3));
+        }
+
+        REQUIRE(absW == Approx(4 / (3 * PI)).margin(3e-3));
+    }
+
+    SECTION("Single precision")
+    {
+        const RandomRotationGenerator<float> single{42};
+        std::vector<Quaternion<float>> floats(1000);
+        single.Generate(floats);
+
+        for (std::size_t i = 0; i < floats.size(); ++i)
+        {
+            REQUIRE(IsUnit(floats[i], 1e-6f));
+            REQUIRE(floats[i].W() == Approx(samples[i].W()).margin(1e-5));
+        }
+    }
+}
+
+TEST_CASE("Random perturbations")
+{
+    constexpr std::size_t count = 100000;
+    const RandomRotationGenerator<double> generator{7};
+    const auto mean = Quaternion<double>{1, -2, 0.5, 3}.Normalized();
+
+    SECTION("Angles are bounded and follow the restricted Haar measure")
+    {
+        for (const double maxAngle : {1e-6, 0.1, 1.0, PI})
+        {
+            std::vector<Quaternion<double>> samples(count);
+            generator.Perturb(mean, maxAngle, samples, 0, 3);
+
+            const double half = maxAngle / 2;
+            const double expected =
+                (half - std::sin(half)) / (maxAngle - std::sin(maxAngle));
+            std::size_t inside = 0;
+
+            for (const auto& q : samples)
+            {
+                REQUIRE(IsUnit(q, 1e-14));
+                REQUIRE(AngleBetween(q, mean) <= maxAngle + 1e-7);
+
+                inside += AngleBetween(q, mean) <= half ? 1 : 0;
+            }
+
+            REQUIRE(static_cast<double>(inside) / count == Approx(expected).margin(5e-3));
+        }
+    }
+
+    SECTION("Batched and single perturbations agree")
+    {
+        QuaternionSoA<double> soa(300);
+        generator.Perturb(mean, 0.5, soa.View(), 100);
+
+        for (std::size_t i = 0; i < soa.Size(); ++i)
+        {
+            REQUIRE(soa.View().Load(i) == generator.Perturbation(mean, 0.5, 100 + i));
+        }
+    }
+
+    SECTION("Zero angle returns the mean")
+    {
+        REQUIRE(quaternionlib::IsApproxEqual(generator.Perturbation(mean, 0.0, 3), mean));
+    }
+}
@@ -0,0 +1,230 @@
+#include <QuaternionRing.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if defined(QUATERNIONLIB_HAS_SHM)
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    using quaternionlib::Quaternion;
+    using quaternionlib::RingRead;
+    using quaternionlib::SharedRingReader;
+    using quaternionlib::SharedRingWriter;
+    using quaternionlib::StampedQuaternion;
+
+    // Unique per test process, so parallel test runs do not collide.
+    auto RingName(const char* suffix) -> std::string
+    {
+        return "/quaternionlib_test_" + std::to_string(::getpid()) + "_" + suffix;
+    }
+
+    auto Copy(SharedRingReader<double>& reader, StampedQuaternion<double>& out) -> RingRead
+    {
+        return reader.Read([&](const StampedQuaternion<double>& record) { out = record; });
+    }
+    // Body of a forked consumer: signals ready once its reader is open, then checks that count
+    // records arrive in order. Returns the exit status.
+    auto ConsumeInChild(const std::string& name, int ready, std::int64_t count) noexcept -> int
+    {
+        try
+        {
+            SharedRingReader<double> reader{name};
+            StampedQuaternion<double> record{};
+            const char byte = 1;
+
+            if (::write(ready, &byte, 1) != 1)
+            {
+                return 2;
+            }
+
+            for (std::int64_t expected = 0; expected < count;)
+            {
+                const auto status = Copy(reader, record);
+
+                if (status == RingRead::Overrun ||
+                    (status == RingRead::Ready && record.timestamp != expected++))
+                {
+                    return 1;
+                }
+            }
+
+            return 0;
+        }
+        catch (...)
+        {
+            return 3;
+        }
+    }
+} // namespace
+
+TEST_CASE("Shared memory ring")
+{
+    const auto name = RingName("ring");
+
+    SECTION("Records reach every reader in order")
+    {
+        SharedRingWriter<double> writer{name, 8};
+        SharedRingReader<double> first{name};
+        SharedRingReader<double> second{name};
+        StampedQuaternion<double> record{};
+
+        REQUIRE(Copy(first, record) == RingRead::Empty);
+
+        writer.Publish(10, Quaternion<double>{1.0, 2.0, 3.0, 4.0});
+        writer.Publish(20, Quaternion<double>{5.0, 6.0, 7.0, 8.0});
+
+        REQUIRE(first.Available() == 2);
+        REQUIRE(Copy(first, record) == RingRead::Ready);
+        REQUIRE(record.timestamp == 10);
+        REQUIRE(record.Orientation() == Quaternion<double>{1.0, 2.0, 3.0, 4.0});
+        REQUIRE(Copy(first, record) == RingRead::Ready);
+        REQUIRE(record.timestamp == 20);
+        REQUIRE(Copy(first, record) == RingRead::Empty);
+
+        REQUIRE(Copy(second, record) == RingRead::Ready);
+        REQUIRE(record.timestamp == 10);
+    }
+
+    SECTION("Readers start at the next record published")
+    {
+        SharedRingWriter<double> writer{name, 8};
+        writer.Publish(1, Quaternion<double>{0.0, 0.0, 0.0, 1.0});
+
+        SharedRingReader<double> reader{name};
+        StampedQuaternion<double> record{};
+
+        REQUIRE(Copy(reader, record) == RingRead::Empty);
+
+        writer.Publish(2, Quaternion<double>{0.0, 0.0, 0.0, 1.0});
+
+        REQUIRE(Copy(reader, record) == RingRead::Ready);
+        REQUIRE(record.timestamp == 2);
+    }
+
+    SECTION("Overruns are detected and skipped")
+    {
+        SharedRingWriter<double> writer{name, 4};
+        SharedRingReader<double> reader{name};
+        StampedQuaternion<double> record{};
+
+        for (std::int64_t i = 0; i < 10; ++i)
+        {
+            writer.Publish(i, Quaternion<double>{0.0, 0.0, 0.0, 1.0});
+        }
+
+        REQUIRE(Copy(reader, record) == RingRead::Overrun);
+        REQUIRE(reader.Lost() == 7);
+
+        for (std::int64_t expected = 7; expected < 10; ++expected)
+        {
+            REQUIRE(Copy(reader, record) == RingRead::Ready);
+            REQUIRE(record.timestamp == expected);
+        }
+
+        REQUIRE(Copy(reader, record) == RingRead::Empty);
+    }
+
+    SECTION("Concurrent producer")
+    {
+        constexpr std::int64_t count = 200000;
+
+        SharedRingWriter<double> writer{name, 64};
+        SharedRingReader<double> reader{name};
+        std::atomic<bool> done = false;
+
+        std::thread producer{[&]
+                             {
+                                 for (std::int64_t i = 0; i < count; ++i)
+                                 {
+                                     const auto v = static_cast<double>(i);
+                                     writer.Publish(i, Quaternion<double>{v, v, v, v});
+                                 }
+
+                                 done = true;
+                             }};
+
+        std::int64_t received = 0;
+        std::int64_t last = -1;
+        bool consistent = true;
+        StampedQuaternion<double> record{};
+
+        while (true)
+        {
+            const auto status = Copy(reader, record);
+
+            if (status == RingRead::Ready)
+            {
+                const auto v = static_cast<double>(record.timestamp);
+
+                consistent = consistent && record.timestamp > last && record.x == v &&
+                             record.y == v && record.z == v && record.w == v;
+                last = record.timestamp;
+                ++received;
+            }
+            else if (status == RingRead::Empty && done && reader.Available() == 0)
+            {
+                break;
+            }
+        }
+
+        producer.join();
+
+        REQUIRE(consistent);
+        REQUIRE(received + static_cast<std::int64_t>(reader.Lost()) == count);
+    }
+
+    SECTION("Separate processes")
+    {
+        constexpr std::int64_t count = 1000;
+
+        SharedRingWriter<double> writer{name, 1024};
+        int ready[2];
+
+        REQUIRE(::pipe(ready) == 0);
+
+        const pid_t child = ::fork();
+
+        REQUIRE(child >= 0);
+
+        if (child == 0)
+        {
+            ::close(ready[0]);
+            ::_exit(ConsumeInChild(name, ready[1], count));
+        }
+
+        // The child's reader starts at the head, so wait for it to open before publishing.
+        ::close(ready[1]);
+        char byte = 0;
+        REQUIRE(::read(ready[0], &byte, 1) == 1);
+        ::close(ready[0]);
+
+        for (std::int64_t i = 0; i < count; ++i)
+        {
+            writer.Publish(i, Quaternion<double>{0.0, 0.0, 0.0, 1.0});
+        }
+
+        int status = 0;
+        REQUIRE(::waitpid(child, &status, 0) == child);
+        REQUIRE(WIFEXITED(status));
+        REQUIRE(WEXITSTATUS(status) == 0);
+    }
+
+    SECTION("Errors")
+    {
+        REQUIRE_THROWS_AS(SharedRingWriter<double>(name, 3), std::invalid_argument);
+        REQUIRE_THROWS_AS(SharedRingReader<double>{name}, std::system_error);
+
+        SharedRingWriter<double> writer{name, 4};
+
+        REQUIRE_THROWS_AS(SharedRingWriter<double>(name, 4), std::system_error);
+        REQUIRE_THROWS_AS(SharedRingReader<float>{name}, std::system_error);
+    }
+}
+#endif
@@ -0,0 +1,196 @@
+#include <AttitudeIntegrator.hpp>
+#include <AttitudeSimplifier.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    using quaternionlib::AttitudeSimplifier;
+    using quaternionlib::Keyframe;
+    using quaternionlib::Quaternion;
+
+    struct Trajectory
+    {
+        std::vector<double> times;
+        std::vector<Quaternion<double>> orientations;
+    };
+
+    // 100 Hz samples of a body tumbling with a slowly varying angular velocity.
+    auto Tumbling(std::size_t count) -> Trajectory
+    {
+        constexpr double dt = 0.01;
+
+        Trajectory trajectory;
+        Quaternion<double> q{0.0, 0.0, 0.0, 1.0};
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const double t = static_cast<double>(i) * dt;
+
+            trajectory.times.push_back(t);
+            trajectory.orientations.push_back(q);
+            quaternionlib::IntegrateExponential(q, 0.8 * std::sin(0.5 * t), 0.3,
+                                                1.5 * std::cos(0.2 * t), dt);
+        }
+
+        return trajectory;
+    }
+
+    auto Simplify(const Trajectory& trajectory, double tolerance) -> std::vector<Keyframe<double>>
+    {
+        AttitudeSimplifier<double> simplifier{tolerance};
+        std::vector<Keyframe<double>> keyframes;
+
+        for (std::size_t i = 0; i < trajectory.times.size(); ++i)
+        {
+            if (const auto key = simplifier.Push(trajectory.times[i], trajectory.orientations[i]))
+            {
+                keyframes.push_back(*key);
+            }
+        }
+
+        if (const auto key = simplifier.Flush())
+        {
+            keyframes.push_back(*key);
+        }
+
+        return keyframes;
+    }
+} // namespace
+
+TEST_CASE("Attitude stream simplification")
+{
+    constexpr double tolerance = 1e-3;
+
+    const auto trajectory = Tumbling(6000);
+    const auto keyframes = Simplify(trajectory, tolerance);
+
+    SECTION("Every sample is reconstructed within the tolerance")
+    {
+        std::vector<Quaternion<double>> reconstructed(trajectory.times.size());
+        quaternionlib::Reconstruct<double>(keyframes, trajectory.times, reconstructed);
+
+        for (std::size_t i = 0; i < reconstructed.size(); ++i)
+        {
+            REQUIRE(quaternionlib::AngularDistance(reconstructed[i],
+                                                   trajectory.orientations[i]) <=
+                    tolerance + 1e-9);
+        }
+    }
+
+    SECTION("Smooth motion compresses well")
+    {
+        REQUIRE(keyframes.size() * 10 < trajectory.times.size());
+        REQUIRE(keyframes.front().time == trajectory.times.front());
+        REQUIRE(keyframes.back().time == trajectory.times.back());
+
+        for (std::size_t i = 1; i < keyframes.size(); ++i)
+        {
+            REQUIRE(keyframes[i - 1].time < keyframes[i].time);
+        }
+    }
+
+    SECTION("Zero tolerance keeps the samples")
+    {
+        const auto exact = Simplify(Tumbling(50), 0.0);
+
+        REQUIRE(exact.size() == 50);
+    }
+
+    SECTION("Streams restart after a flush")
+    {
+        AttitudeSimplifier<double> simplifier{tolerance};
+        const Quaternion<double> identity{0.0, 0.0, 0.0, 1.0};
+
+        REQUIRE(simplifier.Push(0.0, identity).has_value());
+        REQUIRE_FALSE(simplifier.Flush().has_value());
+        REQUIRE(simplifier.Push(0.0, identity).has_value());
+        REQUIRE_FALSE(simplifier.Push(1.0, identity).has_value());
+        REQUIRE(simplifier.Flush()->time == 1.0);
+    }
+
+    SECTION("Invalid input")
+    {
+        REQUIRE_THROWS_AS(AttitudeSimplifier<double>{-1.0}, std::invalid_argument);
+
+        AttitudeSimplifier<double> simplifier{tolerance};
+        const Quaternion<double> identity{0.0, 0.0, 0.0, 1.0};
+
+        (void)simplifier.Push(1.0, identity);
+
+        REQUIRE_THROWS_AS(simplifier.Push(1.0, identity), std::invalid_argument);
+
+        std::vector<Quaternion<double>> out(1);
+        const std::vector<double> times{0.0};
+
+        REQUIRE_THROWS_AS(quaternionlib::Reconstruct<double>({}, times, out),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("Bulk reconstruction")
+{
+    const auto trajectory = Tumbling(3000);
+    const auto keyframes = Simplify(trajectory, 1e-2);
+
+    // Times before, between and after the keyframes.
+    std::vector<double> times;
+
+    for (double t = -0.5; t < trajectory.times.back() + 0.5; t += 0.0037)
+    {
+        times.push_back(t);
+    }
+
+    SECTION("Matches scalar Slerp between the keyframes")
+    {
+        std::vector<Quaternion<double>> out(times.size());
+        quaternionlib::Reconstruct<double>(keyframes, times, out, 3);
+
+        std::size_t segment = 0;
+
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            while (segment + 2 < keyframes.size() && times[i] >= keyframes[segment + 1].time)
+            {
+                ++segment;
+            }
+
+            const auto& from = keyframes[segment];
+            const auto& to = keyframes[segment + 1];
+            const double s = std::clamp((times[i] - from.time) / (to.time - from.time), 0.0, 1.0);
+            const auto expected = quaternionlib::Slerp(from.orientation, to.orientation, s);
+
+            REQUIRE(quaternionlib::AngularDistance(out[i], expected) <= 1e-12);
+        }
+    }
+
+    SECTION("All layouts agree")
+    {
+        std::vector<Quaternion<double>> aos(times.size());
+        quaternionlib::QuaternionSoA<double> soa(times.size());
+
+        quaternionlib::Reconstruct<double>(keyframes, times, aos);
+        quaternionlib::Reconstruct<double>(keyframes, times, soa.View(), 2);
+
+        for (std::size_t i = 0; i < times.size(); ++i)
+        {
+            REQUIRE(soa.View().Load(i) == aos[i]);
+        }
+    }
+
+    SECTION("A single keyframe is held")
+    {
+        const std::vector<Keyframe<double>> single{keyframes.front()};
+        std::vector<Quaternion<double>> out(times.size());
+
+        quaternionlib::Reconstruct<double>(single, times, out);
+
+        for (const auto& q : out)
+        {
+            REQUIRE(quaternionlib::AngularDistance(q, keyframes.front().orientation) <= 1e-15);
+        }
+    }
+}
@@ -0,0 +1,132 @@
+#include <QuaternionSparse.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+
+using Catch::Approx;
+
+namespace
+{
+    constexpr auto PI = 3.14159265358979323846;
+
+    using quaternionlib::Axis;
+    using quaternionlib::AxisQuaternion;
+    using quaternionlib::PureQuaternion;
+    using quaternionlib::Quaternion;
+
+    template <Axis A, Axis B>
+    constexpr auto CheckAxisPair() -> bool
+    {
+        constexpr AxisQuaternion<int, A> a{3, -2};
+        constexpr AxisQuaternion<int, B> b{-5, 7};
+
+        return Quaternion<int>{a * b} == Quaternion<int>{a} * Quaternion<int>{b};
+    }
+} // namespace
+
+TEST_CASE("Pure quaternion products")
+{
+    constexpr Quaternion<int> q{2, -3, 5, 7};
+    constexpr PureQuaternion<int> p{-1, 4, 6};
+    constexpr PureQuaternion<int> r{3, 2, -8};
+    constexpr Quaternion<int> pq{p};
+
+    SECTION("Conversion")
+    {
+        STATIC_REQUIRE(pq == Quaternion<int>{-1, 4, 6, 0});
+        STATIC_REQUIRE(p.W() == 0);
+    }
+
+    SECTION("Products match the general Hamilton product")
+    {
+        STATIC_REQUIRE(q * p == q * pq);
+        STATIC_REQUIRE(p * q == pq * q);
+        STATIC_REQUIRE(p * r == pq * Quaternion<int>{r});
+    }
+
+    SECTION("In-place product")
+    {
+        auto lhs = q;
+        lhs *= p;
+
+        REQUIRE(lhs == q * pq);
+    }
+
+    SECTION("Mixed types")
+    {
+        constexpr PureQuaternion<double> pd{0.5, -1.5, 2.0};
+
+        STATIC_REQUIRE(q * pd == q * Quaternion<double>{pd});
+    }
+}
+
+TEST_CASE("Axis quaternion products")
+{
+    constexpr Quaternion<int> q{2, -3, 5, 7};
+
+    SECTION("Quaternion times axis quaternion")
+    {
+        constexpr AxisQuaternion<int, Axis::X> x{4, -6};
+        constexpr AxisQuaternion<int, Axis::Y> y{4, -6};
+        constexpr AxisQuaternion<int, Axis::Z> z{4, -6};
+
+        STATIC_REQUIRE(Quaternion<int>{x} == Quaternion<int>{4, 0, 0, -6});
+        STATIC_REQUIRE(Quaternion<int>{y} == Quaternion<int>{0, 4, 0, -6});
+        STATIC_REQUIRE(Quaternion<int>{z} == Quaternion<int>{0, 0, 4, -6});
+
+        STATIC_REQUIRE(q * x == q * Quaternion<int>{x});
+        STATIC_REQUIRE(q * y == q * Quaternion<int>{y});
+        STATIC_REQUIRE(q * z == q * Quaternion<int>{z});
+        STATIC_REQUIRE(x * q == Quaternion<int>{x} * q);
+        STATIC_REQUIRE(y * q == Quaternion<int>{y} * q);
+        STATIC_REQUIRE(z * q == Quaternion<int>{z} * q);
+    }
+
+    SECTION("Axis quaternion pairs")
+    {
+        STATIC_REQUIRE(CheckAxisPair<Axis::X, Axis::X>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::X, Axis::Y>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::X, Axis::Z>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::Y, Axis::X>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::Y, Axis::Y>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::Y, Axis::Z>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::Z, Axis::X>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::Z, Axis::Y>());
+        STATIC_REQUIRE(CheckAxisPair<Axis::Z, Axis::Z>());
+    }
+
+    SECTION("Same axis rotations compose angles")
+    {
+        const auto a = quaternionlib::ZAxisQuaternion<double>::FromAngle(PI / 3);
+        const auto b = quaternionlib::ZAxisQuaternion<double>::FromAngle(PI / 6);
+        const auto c = a * b;
+
+        STATIC_REQUIRE(std::is_same_v<decltype(c), const quaternionlib::ZAxisQuaternion<double>>);
+        REQUIRE(c.V() == Approx(std::sin(PI / 4)));
+        REQUIRE(c.W() == Approx(std::cos(PI / 4)));
+    }
+}
+
+TEST_CASE("Rotating vectors")
+{
+    const auto q = Quaternion<double>{0.3, -0.2, 0.7, 0.5}.Normalized();
+    constexpr PureQuaternion<double> v{1.0, 2.0, -3.0};
+
+    const auto rotated = quaternionlib::Rotate(q, v);
+    const auto expected = q * v * q.Conjugated();
+
+    REQUIRE(rotated.X() == Approx(expected.X()));
+    REQUIRE(rotated.Y() == Approx(expected.Y()));
+    REQUIRE(rotated.Z() == Approx(expected.Z()));
+    REQUIRE(expected.W() == Approx(0.0).margin(1e-15));
+
+    SECTION("Quarter turn about z")
+    {
+        const Quaternion<double> quarter{quaternionlib::ZAxisQuaternion<double>::FromAngle(PI / 2)};
+        const auto r = quaternionlib::Rotate(quarter, PureQuaternion<double>{1.0, 0.0, 0.0});
+
+        REQUIRE(r.X() == Approx(0.0).margin(1e-15));
+        REQUIRE(r.Y() == Approx(1.0));
+        REQUIRE(r.Z() == Approx(0.0).margin(1e-15));
+    }
+}
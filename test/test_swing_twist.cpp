@@ -0,0 +1,255 @@
+#include <QuaternionSwingTwist.hpp>
+#include "RandomRotations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    using quaternionlib::ComponentOrder;
+    using quaternionlib::JointLimits;
+    using quaternionlib::PureQuaternion;
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::QuaternionStridedView;
+    using quaternionlib::test::RandomRotations;
+
+    // Rotation by angle about the unit axis (x, y, z).
+    auto Rotation(double x, double y, double z, double angle) -> Quaternion<double>
+    {
+        const double s = std::sin(angle / 2);
+
+        return Quaternion<double>{x * s, y * s, z * s, std::cos(angle / 2)};
+    }
+
+    auto Close(const Quaternion<double>& a, const Quaternion<double>& b,
+               double tolerance = 1e-14) -> bool
+    {
+        return std::abs(a.X() - b.X()) <= tolerance && std::abs(a.Y() - b.Y()) <= tolerance &&
+               std::abs(a.Z() - b.Z()) <= tolerance && std::abs(a.W() - b.W()) <= tolerance;
+    }
+
+    auto IsUnit(const Quaternion<double>& q) -> bool
+    {
+        return std::abs(q.Norm() - 1) <= 1e-15;
+    }
+
+    const PureQuaternion<double> AXIS{0.6, 0.0, 0.8};
+    const JointLimits<double> LIMITS{0.7, -0.4, 0.9};
+} // namespace
+
+TEST_CASE("Swing-twist decomposition")
+{
+    SECTION("Random rotations")
+    {
+        for (const auto& q : RandomRotations(2000, 1))
+        {
+            const auto [swing, twist] = quaternionlib::DecomposeSwingTwist(q, AXIS);
+
+            REQUIRE(Close(swing * twist, q));
+            REQUIRE(swing.W() >= 0);
+            REQUIRE(IsUnit(swing));
+            REQUIRE(IsUnit(twist));
+
+            // Twist parallel and swing perpendicular to the axis.
+            REQUIRE(std::abs(twist.Y()) <= 1e-15);
+            REQUIRE(std::abs(twist.X() * AXIS.Z() - twist.Z() * AXIS.X()) <= 1e-15);
+            REQUIRE(std::abs(swing.X() * AXIS.X() + swing.Y() * AXIS.Y() +
+                             swing.Z() * AXIS.Z()) <= 1e-15);
+        }
+    }
+
+    SECTION("Known parts")
+    {
+        const PureQuaternion<double> z{0.0, 0.0, 1.0};
+        const auto swing = Rotation(1.0, 0.0, 0.0, 0.8);
+        const auto twist = Rotation(0.0, 0.0, 1.0, -1.3);
+
+        const auto parts = quaternionlib::DecomposeSwingTwist(swing * twist, z);
+
+        REQUIRE(Close(parts.swing, swing));
+        REQUIRE(Close(parts.twist, twist));
+    }
+
+    SECTION("Half-turn swing leaves the twist undefined")
+    {
+        const auto q = Rotation(0.0, 1.0, 0.0, std::numbers::pi);
+        const auto [swing, twist] =
+            quaternionlib::DecomposeSwingTwist(q, PureQuaternion<double>{0.0, 0.0, 1.0});
+
+        REQUIRE(twist == Quaternion<double>{0.0, 0.0, 0.0, 1.0});
+        REQUIRE(swing == q);
+    }
+}
+
+TEST_CASE("Joint limit clamping")
+{
+    const PureQuaternion<double> z{0.0, 0.0, 1.0};
+    const JointLimits<double> limits{0.5, -0.3, 0.6};
+
+    SECTION("Rotations within the limits are unchanged")
+    {
+        const auto q = Rotation(0.6, 0.8, 0.0, 0.4) * Rotation(0.0, 0.0, 1.0, 0.5);
+
+        REQUIRE(Close(quaternionlib::ClampJoint(q, z, limits), q));
+        REQUIRE(Close(quaternionlib::ClampJoint(-q, z, limits), -q));
+    }
+
+    SECTION("Twist is clamped to its bounds")
+    {
+        const auto swing = Rotation(1.0, 0.0, 0.0, 0.2);
+
+        REQUIRE(Close(quaternionlib::ClampJoint(swing * Rotation(0.0, 0.0, 1.0, 1.4), z, limits),
+                      swing * Rotation(0.0, 0.0, 1.0, 0.6)));
+        REQUIRE(Close(quaternionlib::ClampJoint(swing * Rotation(0.0, 0.0, 1.0, -2.5), z, limits),
+                      swing * Rotation(0.0, 0.0, 1.0, -0.3)));
+    }
+
+    SECTION("Twist is clamped to the bound nearer around the circle")
+    {
+        const double degree = std::numbers::pi / 180;
+        const JointLimits<double> wrapped{0.5, -170 * degree, 0.0};
+        const auto swing = Rotation(1.0, 0.0, 0.0, 0.2);
+        const auto clamp = [&](double twist)
+        {
+            return quaternionlib::ClampJoint(swing * Rotation(0.0, 0.0, 1.0, twist), z, wrapped);
+        };
+
+        REQUIRE(Close(clamp(175 * degree), swing * Rotation(0.0, 0.0, 1.0, -170 * degree)));
+        REQUIRE(Close(clamp(-175 * degree), swing * Rotation(0.0, 0.0, 1.0, -170 * degree)));
+        REQUIRE(Close(clamp(30 * degree), swing * Rotation(0.0, 0.0, 1.0, 0.0)));
+    }
+
+    SECTION("Swing is scaled onto the cone along its own axis")
+    {
+        const auto twist = Rotation(0.0, 0.0, 1.0, 0.1);
+
+        REQUIRE(Close(quaternionlib::ClampJoint(Rotation(0.6, 0.8, 0.0, 2.0) * twist, z, limits),
+                      Rotation(0.6, 0.8, 0.0, 0.5) * twist));
+        REQUIRE(Close(quaternionlib::ClampJoint(Rotation(0.6, -0.8, 0.0, 3.0) * twist, z, limits),
+                      Rotation(0.6, -0.8, 0.0, 0.5) * twist));
+    }
+
+    SECTION("Both parts end up within the limits")
+    {
+        for (const auto& q : RandomRotations(2000, 2))
+        {
+            const auto clamped = quaternionlib::ClampJoint(q, AXIS, LIMITS);
+            // The twist carries the sign of the quaternion.
+            const auto [swing, twist] = quaternionlib::DecomposeSwingTwist(
+                clamped.W() < 0 ? -clamped : clamped, AXIS);
+            const double twistSine = twist.X() * AXIS.X() + twist.Z() * AXIS.Z();
+            const double twistAngle = 2 * std::atan2(twistSine, twist.W());
+
+            REQUIRE(IsUnit(clamped));
+            REQUIRE(2 * std::acos(std::min(swing.W(), 1.0)) <= LIMITS.Cone() + 1e-7);
+            REQUIRE(twistAngle >= LIMITS.MinTwist() - 1e-12);
+            REQUIRE(twistAngle <= LIMITS.MaxTwist() + 1e-12);
+        }
+    }
+
+    SECTION("Invalid limits")
+    {
+        REQUIRE_THROWS_AS(JointLimits<double>(-0.1, 0.0, 0.0), std::invalid_argument);
+        REQUIRE_THROWS_AS(JointLimits<double>(4.0, 0.0, 0.0), std::invalid_argument);
+        REQUIRE_THROWS_AS(JointLimits<double>(1.0, 0.5, 0.4), std::invalid_argument);
+        REQUIRE_THROWS_AS(JointLimits<double>(1.0, -4.0, 0.0), std::invalid_argument);
+    }
+
+    SECTION("Constant evaluation")
+    {
+        constexpr JointLimits<double> constant{0.5, -0.3, 0.6};
+        constexpr auto clamped = quaternionlib::ClampJoint(
+            Quaternion<double>{0.0, 0.0, 0.8, 0.6}, PureQuaternion<double>{0.0, 0.0, 1.0},
+            constant);
+
+        static_assert(clamped.W() < 1 && clamped.Z() > 0);
+        REQUIRE(Close(clamped, Rotation(0.0, 0.0, 1.0, 0.6)));
+    }
+}
+
+TEST_CASE("Batched swing-twist")
+{
+    const auto points = RandomRotations(5000, 3);
+
+    SECTION("AoS")
+    {
+        std::vector<Quaternion<double>> swings(points.size()), twists(points.size());
+        std::vector<Quaternion<double>> clamped(points.size());
+        std::vector<Quaternion<double>> inPlace = points;
+
+        quaternionlib::DecomposeSwingTwist<double>(points, AXIS, swings, twists, 3);
+        quaternionlib::ClampJoints<double>(points, AXIS, LIMITS, clamped, 2);
+        quaternionlib::ClampJoints<double>(inPlace, AXIS, LIMITS);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const auto [swing, twist] = quaternionlib::DecomposeSwingTwist(points[i], AXIS);
+            const auto expected = quaternionlib::ClampJoint(points[i], AXIS, LIMITS);
+
+            REQUIRE(Close(swings[i], swing));
+            REQUIRE(Close(twists[i], twist));
+            REQUIRE(Close(clamped[i], expected));
+            REQUIRE(Close(inPlace[i], expected));
+        }
+    }
+
+    SECTION("SoA")
+    {
+        const QuaternionSoA<double> in{points};
+        QuaternionSoA<double> swings(points.size()), twists(points.size());
+        QuaternionSoA<double> clamped(points.size());
+        QuaternionSoA<double> inPlace{points};
+
+        quaternionlib::DecomposeSwingTwist<double>(in.View(), AXIS, swings.View(), twists.View());
+        quaternionlib::ClampJoints<double>(in.View(), AXIS, LIMITS, clamped.View(), 3);
+        quaternionlib::ClampJoints<double>(inPlace.View(), AXIS, LIMITS, 2);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const auto [swing, twist] = quaternionlib::DecomposeSwingTwist(points[i], AXIS);
+            const auto expected = quaternionlib::ClampJoint(points[i], AXIS, LIMITS);
+
+            REQUIRE(Close(swings.View().Load(i), swing));
+            REQUIRE(Close(twists.View().Load(i), twist));
+            REQUIRE(Close(clamped.View().Load(i), expected));
+            REQUIRE(Close(inPlace.View().Load(i), expected));
+        }
+    }
+
+    SECTION("Strided views")
+    {
+        std::vector<double> buffer;
+
+        for (const auto& p : points)
+        {
+            buffer.insert(buffer.end(), {p.W(), p.X(), p.Y(), p.Z()});
+        }
+
+        const QuaternionStridedView<double, ComponentOrder::WXYZ> view{buffer.data(),
+                                                                        points.size()};
+
+        std::vector<double> swingBuffer(buffer.size()), twistBuffer(buffer.size());
+        const QuaternionStridedView<double, ComponentOrder::WXYZ> swings{swingBuffer.data(),
+                                                                          points.size()};
+        const QuaternionStridedView<double, ComponentOrder::WXYZ> twists{twistBuffer.data(),
+                                                                          points.size()};
+
+        quaternionlib::DecomposeSwingTwist(
+            QuaternionStridedView<const double, ComponentOrder::WXYZ>{buffer.data(),
+                                                                      points.size()},
+            AXIS, swings, twists, 2);
+        quaternionlib::ClampJoints(view, AXIS, LIMITS, 2);
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            const auto [swing, twist] = quaternionlib::DecomposeSwingTwist(points[i], AXIS);
+
+            REQUIRE(Close(swings.Load(i), swing));
+            REQUIRE(Close(twists.Load(i), twist));
+            REQUIRE(Close(view.Load(i), quaternionlib::ClampJoint(points[i], AXIS, LIMITS)));
+        }
+    }
+}
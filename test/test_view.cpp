@@ -0,0 +1,155 @@
+#include <AttitudeIntegrator.hpp>
+#include <QuaternionDistance.hpp>
+#include <QuaternionRandom.hpp>
+#include <QuaternionView.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+    using quaternionlib::ComponentOrder;
+    using quaternionlib::Quaternion;
+    using quaternionlib::QuaternionSoA;
+    using quaternionlib::QuaternionStridedView;
+
+    struct Pose
+    {
+        double timestamp;
+        double position[3];
+        double orientation[4];
+    };
+
+    auto MakePoses(std::size_t count) -> std::vector<Pose>
+    {
+        std::vector<Quaternion<double>> rotations(count);
+        quaternionlib::RandomRotationGenerator<double>{3}.Generate(rotations);
+
+        std::vector<Pose> poses(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            poses[i].timestamp = static_cast<double>(i);
+            poses[i].position[0] = 1.0;
+            poses[i].orientation[0] = rotations[i].W();
+            poses[i].orientation[1] = rotations[i].X();
+            poses[i].orientation[2] = rotations[i].Y();
+            poses[i].orientation[3] = rotations[i].Z();
+        }
+
+        return poses;
+    }
+
+    auto Rotations(const std::vector<Pose>& poses) -> std::vector<Quaternion<double>>
+    {
+        std::vector<Quaternion<double>> out;
+
+        for (const auto& pose : poses)
+        {
+            out.emplace_back(pose.orientation[1], pose.orientation[2], pose.orientation[3],
+                             pose.orientation[0]);
+        }
+
+        return out;
+    }
+} // namespace
+
+TEST_CASE("Strided quaternion views")
+{
+    SECTION("Packed w-first buffer")
+    {
+        std::vector<float> buffer{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        const QuaternionStridedView<float, ComponentOrder::WXYZ> view{buffer.data(), 2};
+
+        REQUIRE(view.Size() == 2);
+        REQUIRE(view.Load(0) == Quaternion<float>{2.0f, 3.0f, 4.0f, 1.0f});
+        REQUIRE(view.Subspan(1, 1).Load(0) == Quaternion<float>{6.0f, 7.0f, 8.0f, 5.0f});
+
+        view.Store(1, Quaternion<float>{-1.0f, -2.0f, -3.0f, -4.0f});
+        REQUIRE(buffer == std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f, -4.0f, -1.0f, -2.0f, -3.0f});
+
+        const QuaternionStridedView<const float, ComponentOrder::WXYZ> readOnly{view};
+        REQUIRE(readOnly.Load(1) == view.Load(1));
+    }
+
+    SECTION("Interleaved pose records")
+    {
+        auto poses = MakePoses(10);
+        const auto expected = Rotations(poses);
+        const auto view = quaternionlib::ViewMember<ComponentOrder::WXYZ>(std::span{poses},
+                                                                          &Pose::orientation);
+
+        REQUIRE(view.RecordStride() == sizeof(Pose) / sizeof(double));
+
+        for (std::size_t i = 0; i < poses.size(); ++i)
+        {
+            REQUIRE(view.Load(i) == expected[i]);
+        }
+
+        const std::span<const Pose> constant{poses};
+        const auto readOnly =
+            quaternionlib::ViewMember<ComponentOrder::WXYZ>(constant, &Pose::orientation);
+
+        REQUIRE(readOnly.Load(9) == expected[9]);
+    }
+}
+
+TEST_CASE("Batched operations on foreign buffers")
+{
+    constexpr std::size_t count = 1000;
+
+    auto poses = MakePoses(count);
+    const auto view = quaternionlib::ViewMember<ComponentOrder::WXYZ>(std::span{poses},
+                                                                      &Pose::orientation);
+    const auto rotations = Rotations(poses);
+
+    SECTION("Integration in place")
+    {
+        QuaternionSoA<double> soa{rotations};
+        std::vector<double> wx(count, 0.3), wy(count, -0.2), wz(count, 1.5);
+        const quaternionlib::Vector3SoASpan<const double> omega{wx, wy, wz};
+
+        quaternionlib::IntegrateExponential(soa.View(), omega, 0.01);
+        quaternionlib::IntegrateExponential(view, omega, 0.01, 2);
+        quaternionlib::IntegrateRK4(soa.View(), omega, 0.01);
+        quaternionlib::IntegrateRK4(view, omega, 0.01);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(view.Load(i) == soa.View().Load(i));
+            REQUIRE(poses[i].timestamp == static_cast<double>(i));
+            REQUIRE(poses[i].position[0] == 1.0);
+        }
+    }
+
+    SECTION("Random generation")
+    {
+        const quaternionlib::RandomRotationGenerator<double> generator{11};
+        std::vector<Quaternion<double>> expected(count);
+
+        generator.Generate(expected);
+        generator.Generate(view);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(view.Load(i) == expected[i]);
+        }
+    }
+
+    SECTION("Distances")
+    {
+        std::vector<double> fromView(count);
+        std::vector<double> fromAoS(count);
+        std::vector<double> matrix(count * 20);
+        std::vector<double> matrixAoS(count * 20);
+
+        quaternionlib::Distances(rotations[5], view, std::span{fromView});
+        quaternionlib::Distances<double>(rotations[5], rotations, fromAoS);
+        quaternionlib::DistanceMatrix(view, view.Subspan(0, 20), std::span{matrix});
+        quaternionlib::DistanceMatrix<double>(rotations, std::span{rotations}.first(20),
+                                              matrixAoS);
+
+        REQUIRE(fromView == fromAoS);
+        REQUIRE(matrix == matrixAoS);
+        REQUIRE(quaternionlib::Nearest(rotations[5], view) == 5);
+    }
+}